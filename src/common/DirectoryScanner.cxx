@@ -0,0 +1,101 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "FSNodeFactory.hxx"
+#include "DirectoryScanner.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+DirectoryScanner::DirectoryScanner(const FilesystemNode& root)
+  : myPool{Common::WorkerPool<FSList>::threadCount(MIN_THREADS, MAX_THREADS)}
+{
+  const AbstractFSNodePtr dir = root._realNode;
+  if(dir && dir->isDirectory())
+    myPool.submit([this, dir]{ return readDirectory(dir); });
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+DirectoryScanner::~DirectoryScanner()
+{
+  cancel();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool DirectoryScanner::collect(FSList& list, const FilesystemNode::NameFilter& filter,
+                               uInt32 timeout)
+{
+  std::vector<FSList> found;
+  const bool more = myPool.collect(found, timeout);
+
+  // Filter the new files and append them in sorted order
+  const size_t oldSize = list.size();
+  for(auto& files: found)
+  {
+    for(auto& node: files)
+    {
+    #if defined(ZIP_SUPPORT)
+      if(BSPF::endsWithIgnoreCase(node.getPath(), ".zip"))
+      {
+        // Filter by the archive's contents, but add the archive file itself,
+        // so that no directories (ie, multi file archives) are listed
+        const FilesystemNode zipNode(FilesystemNodeFactory::create(node.getPath(),
+                                     FilesystemNodeFactory::Type::ZIP));
+        if(filter(zipNode))
+          list.push_back(std::move(node));
+        continue;
+      }
+    #endif
+      if(filter(node))
+        list.push_back(std::move(node));
+    }
+  }
+  std::sort(list.begin() + oldSize, list.end(), compare);
+  std::inplace_merge(list.begin(), list.begin() + oldSize, list.end(), compare);
+
+  return more;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void DirectoryScanner::cancel()
+{
+  myPool.stop();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool DirectoryScanner::compare(const FilesystemNode& node1, const FilesystemNode& node2)
+{
+  if(node1.isDirectory() != node2.isDirectory())
+    return node1.isDirectory();
+  else
+    return BSPF::compareIgnoreCase(node1.getName(), node2.getName()) < 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FSList DirectoryScanner::readDirectory(const AbstractFSNodePtr& dir)
+{
+  AbstractFSList children;
+  dir->getChildren(children, FilesystemNode::ListMode::All);
+
+  FSList files;
+  for(auto& child: children)
+  {
+    if(child->isDirectory())
+      myPool.submit([this, subDir = std::move(child)]{ return readDirectory(subDir); });
+    else
+      files.emplace_back(FilesystemNode(child));
+  }
+  return files;
+}
@@ -0,0 +1,100 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef DIRECTORY_SCANNER_HXX
+#define DIRECTORY_SCANNER_HXX
+
+#include "bspf.hxx"
+#include "FSNode.hxx"
+#include "WorkerPool.hxx"
+
+/**
+  This class lists all files in a directory and its subdirectories.  The
+  directories are read by a pool of worker threads, and the files found
+  are merged into a sorted list by the caller as they arrive, so that a
+  large (or slow) directory tree can be shown while it is still scanned.
+
+  Only the file system is accessed by the worker threads; ZIP archives
+  are opened and the name filter is applied on the thread which collects
+  the results.  Directories are only descended into, but never listed.
+*/
+class DirectoryScanner
+{
+  public:
+    // Minimum and maximum number of worker threads; reading directories
+    // mostly waits for the file system, so even on systems with few cores
+    // a few threads are used
+    static constexpr uInt32 MIN_THREADS = 4, MAX_THREADS = 8;
+
+    /**
+      The constructor starts scanning the given directory.
+
+      @param root  The directory to scan (must not be inside a ZIP archive)
+    */
+    explicit DirectoryScanner(const FilesystemNode& root);
+
+    /**
+      The destructor cancels the scan and stops all worker threads.
+    */
+    ~DirectoryScanner();
+
+    /**
+      Wait until more files have been found (or the timeout expired), and
+      merge all files found since the last call into the given list.
+
+      @param list     The sorted list to merge the files into
+      @param filter   Only files accepted by the filter are added
+      @param timeout  The maximum time to wait for new files (in ms)
+
+      @return  False if the scan has finished and all files were collected
+    */
+    bool collect(FSList& list, const FilesystemNode::NameFilter& filter,
+                 uInt32 timeout);
+
+    /**
+      Stop scanning; files not collected yet are discarded.
+    */
+    void cancel();
+
+    /**
+      The sort order of the list (directories first, then by name).
+    */
+    static bool compare(const FilesystemNode& node1, const FilesystemNode& node2);
+
+  private:
+    /**
+      Read the given directory on a worker thread, and queue its
+      subdirectories to be read as well.
+
+      @return  The files in the directory
+    */
+    FSList readDirectory(const AbstractFSNodePtr& dir);
+
+  private:
+    // Each task reads one directory
+    Common::WorkerPool<FSList> myPool;
+
+  private:
+    // Following constructors and assignment operators not supported
+    DirectoryScanner() = delete;
+    DirectoryScanner(const DirectoryScanner&) = delete;
+    DirectoryScanner(DirectoryScanner&&) = delete;
+    DirectoryScanner& operator=(const DirectoryScanner&) = delete;
+    DirectoryScanner& operator=(DirectoryScanner&&) = delete;
+};
+
+#endif
@@ -169,19 +169,51 @@ bool FBSurfaceSDL2::render()
 
   if(myIsVisible && myBlitter)
   {
-    myBlitter->blit(*mySurface);
+    SDL_Rect dirty = mySrcR;
+    if(myHasDirtyRows && !myIsFullyDirty)
+    {
+      dirty.y = myDirtyFirst;
+      dirty.h = myDirtyLast - myDirtyFirst;
+    }
+    myHasDirtyRows = myIsFullyDirty = false;
+    myBlitter->blit(*mySurface, dirty);
 
     return true;
   }
   return false;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FBSurfaceSDL2::setDirtyRows(uInt32 first, uInt32 count)
+{
+  if(count == 0)
+  {
+    if(!myHasDirtyRows)
+    {
+      myDirtyFirst = myDirtyLast = 0;
+      myHasDirtyRows = true;
+    }
+  }
+  else if(!myHasDirtyRows || myDirtyFirst == myDirtyLast)
+  {
+    myDirtyFirst = first;
+    myDirtyLast = first + count;
+    myHasDirtyRows = true;
+  }
+  else
+  {
+    myDirtyFirst = std::min(myDirtyFirst, first);
+    myDirtyLast = std::max(myDirtyLast, first + count);
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void FBSurfaceSDL2::invalidate()
 {
   ASSERT_MAIN_THREAD;
 
   SDL_FillRect(mySurface, nullptr, 0);
+  myIsFullyDirty = true;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -198,6 +230,7 @@ void FBSurfaceSDL2::invalidateRect(uInt32 x, uInt32 y, uInt32 w, uInt32 h)
   // Note: Transparency has to be 0 to clear the rectangle foreground
   //  without affecting the background display.
   SDL_FillRect(mySurface, &tmp, 0);
+  myIsFullyDirty = true;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
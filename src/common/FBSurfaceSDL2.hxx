@@ -57,6 +57,7 @@ class FBSurfaceSDL2 : public FBSurface
 
     void translateCoords(Int32& x, Int32& y) const override;
     bool render() override;
+    void setDirtyRows(uInt32 first, uInt32 count) override;
     void invalidate() override;
     void invalidateRect(uInt32 x, uInt32 y, uInt32 w, uInt32 h) override;
 
@@ -130,6 +131,11 @@ class FBSurfaceSDL2 : public FBSurface
     bool myIsVisible{true};
     bool myIsStatic{false};
 
+    // Rows changed since the last render (all rows if not set, or if the
+    // surface was modified otherwise)
+    bool myHasDirtyRows{false}, myIsFullyDirty{false};
+    uInt32 myDirtyFirst{0}, myDirtyLast{0};
+
     Common::Rect mySrcGUIR, myDstGUIR;
 };
 
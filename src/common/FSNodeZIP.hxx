@@ -52,6 +52,9 @@ class FilesystemNodeZIP : public AbstractFSNode
     bool isFile() const      override { return _isFile;      }
     bool isReadable() const  override { return _realNode && _realNode->isReadable(); }
     bool isWritable() const  override { return false; }
+    uInt64 getLastModified() const override {
+      return _realNode ? _realNode->getLastModified() : 0;
+    }
 
     //////////////////////////////////////////////////////////
     // For now, ZIP files cannot be modified in any way
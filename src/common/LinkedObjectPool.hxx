@@ -149,6 +149,8 @@ class LinkedObjectPool
     /**
       Canonical iterators from C++ STL.
     */
+    iter begin() { return myList.begin(); }
+    iter end()   { return myList.end();   }
     const_iter cbegin() const { return myList.cbegin(); }
     const_iter cend() const   { return myList.cend();   }
 
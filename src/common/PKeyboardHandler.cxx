@@ -515,6 +515,7 @@ PhysicalKeyboardHandler::DefaultCommonMapping = {
   { Event::LoadState,                KBDK_F11 },
   { Event::LoadAllStates,            KBDK_F11, MOD3 },
   { Event::TakeSnapshot,             KBDK_F12 },
+  { Event::ToggleVideoRecording,     KBDK_F12, MOD3 },
   #ifdef BSPF_MACOS
   { Event::TogglePauseMode,          KBDK_P, KBDM_SHIFT | MOD3 },
   #else
@@ -35,6 +35,20 @@
 PNGLibrary::PNGLibrary(OSystem& osystem)
   : myOSystem{osystem}
 {
+  myWriterThread = std::thread(&PNGLibrary::writerMain, this);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+PNGLibrary::~PNGLibrary()
+{
+  // Queued snapshots are still written before the thread quits
+  {
+    std::lock_guard<std::mutex> lock(myWriterMutex);
+    myWriterQuit = true;
+  }
+  myWriterWakeup.notify_one();
+
+  myWriterThread.join();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -125,10 +139,20 @@ void PNGLibrary::loadImage(const string& filename, FBSurface& surface)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PNGLibrary::saveImage(const string& filename, const VariantList& comments)
 {
-  std::ofstream out(filename, std::ios_base::binary);
-  if(!out.is_open())
-    throw runtime_error("ERROR: Couldn't create snapshot file");
+  vector<png_byte> buffer;
+  png_uint_32 width, height;
+
+  readFrameBuffer(buffer, width, height);
 
+  // And save the image
+  saveBufferToDisk(filename, buffer, width, height, comments,
+                   myOSystem.settings().getInt("sscompress"));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::readFrameBuffer(vector<png_byte>& buffer,
+                                 png_uint_32& width, png_uint_32& height) const
+{
   const FrameBuffer& fb = myOSystem.frameBuffer();
 
   const Common::Rect& rectUnscaled = fb.imageRect();
@@ -137,19 +161,11 @@ void PNGLibrary::saveImage(const string& filename, const VariantList& comments)
     fb.scaleX(rectUnscaled.w()), fb.scaleY(rectUnscaled.h())
   );
 
-  png_uint_32 width = rect.w(), height = rect.h();
+  width = rect.w();  height = rect.h();
 
   // Get framebuffer pixel data (we get ABGR format)
-  vector<png_byte> buffer(width * height * 4);
+  buffer.resize(width * height * 4);
   fb.readPixels(buffer.data(), width*4, rect);
-
-  // Set up pointers into "buffer" byte array
-  vector<png_bytep> rows(height);
-  for(png_uint_32 k = 0; k < height; ++k)
-    rows[k] = static_cast<png_bytep>(buffer.data() + k*width*4);
-
-  // And save the image
-  saveImageToDisk(out, rows, width, height, comments);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -178,12 +194,29 @@ void PNGLibrary::saveImage(const string& filename, const FBSurface& surface,
     rows[k] = static_cast<png_bytep>(buffer.data() + k*width*4);
 
   // And save the image
-  saveImageToDisk(out, rows, width, height, comments);
+  saveImageToDisk(out, rows, width, height, comments,
+                  myOSystem.settings().getInt("sscompress"));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::saveBufferToDisk(const string& filename, const vector<png_byte>& buffer,
+    png_uint_32 width, png_uint_32 height, const VariantList& comments, int level)
+{
+  std::ofstream out(filename, std::ios_base::binary);
+  if(!out.is_open())
+    throw runtime_error("ERROR: Couldn't create snapshot file");
+
+  // Set up pointers into "buffer" byte array
+  vector<png_bytep> rows(height);
+  for(png_uint_32 k = 0; k < height; ++k)
+    rows[k] = const_cast<png_bytep>(buffer.data() + k*width*4);
+
+  saveImageToDisk(out, rows, width, height, comments, level);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PNGLibrary::saveImageToDisk(std::ofstream& out, const vector<png_bytep>& rows,
-    png_uint_32 width, png_uint_32 height, const VariantList& comments)
+    png_uint_32 width, png_uint_32 height, const VariantList& comments, int level)
 {
   png_structp png_ptr = nullptr;
   png_infop info_ptr = nullptr;
@@ -209,6 +242,9 @@ void PNGLibrary::saveImageToDisk(std::ofstream& out, const vector<png_bytep>& ro
   // Set up the output control
   png_set_write_fn(png_ptr, &out, png_write_data, png_io_flush);
 
+  // Lower levels are much faster, which matters for continuous snapshots
+  png_set_compression_level(png_ptr, BSPF::clamp(level, 0, 9));
+
   // Write PNG header info
   png_set_IHDR(png_ptr, info_ptr, width, height, 8,
       PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
@@ -243,6 +279,70 @@ void PNGLibrary::saveImageToDisk(std::ofstream& out, const vector<png_bytep>& ro
     png_destroy_write_struct(&png_ptr, &info_ptr);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+vector<png_byte> PNGLibrary::allocateWriteBuffer()
+{
+  std::unique_lock<std::mutex> lock(myWriterMutex);
+
+  // Apply backpressure; don't let the queue (and its memory) grow unbounded
+  myWriterDone.wait(lock, [this]{ return myWriteQueue.size() < MAX_QUEUED_IMAGES; });
+
+  vector<png_byte> buffer;
+  if(!myBufferPool.empty())
+  {
+    buffer = std::move(myBufferPool.back());
+    myBufferPool.pop_back();
+  }
+  return buffer;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::queueImage(WriteJob&& job)
+{
+  {
+    std::lock_guard<std::mutex> lock(myWriterMutex);
+    myWriteQueue.push_back(std::move(job));
+  }
+  myWriterWakeup.notify_one();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::writerMain()
+{
+  std::unique_lock<std::mutex> lock(myWriterMutex);
+
+  while(true)
+  {
+    myWriterWakeup.wait(lock, [this]{ return myWriterQuit || !myWriteQueue.empty(); });
+    if(myWriteQueue.empty())  // only quit when all snapshots are written
+      break;
+
+    WriteJob job = std::move(myWriteQueue.front());
+    myWriteQueue.pop_front();
+
+    // Compress and write without holding the lock
+    lock.unlock();
+    string error;
+    try
+    {
+      saveBufferToDisk(job.filename, job.buffer, job.width, job.height,
+                       job.comments, job.level);
+    }
+    catch(const runtime_error& e)
+    {
+      error = e.what();
+    }
+    lock.lock();
+
+    if(!error.empty())
+      myWriterResult = error;
+    else if(myWriterResult.empty())
+      myWriterResult = "Snapshot saved";
+    myBufferPool.push_back(std::move(job.buffer));
+    myWriterDone.notify_one();
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PNGLibrary::updateTime(uInt64 time)
 {
@@ -313,12 +413,17 @@ void PNGLibrary::takeSnapshot(uInt32 number)
   {
     // Determine if the file already exists, checking each successive filename
     // until one doesn't exist
+    // Since snapshots are written in the background, the previous snapshot
+    // may not exist yet; so continue after the last index used instead
+    uInt32 i = 0;
+    if(sspath == myLastSnapPath)
+      i = myLastSnapIndex + 1;
+
     filename = sspath + ".png";
-    FilesystemNode node(filename);
-    if(node.exists())
+    if(i > 0 || FilesystemNode(filename).exists())
     {
       ostringstream buf;
-      for(uInt32 i = 1; ;++i)
+      for(i = std::max(i, 1U); ;++i)
       {
         buf.str("");
         buf << sspath << "_" << i << ".png";
@@ -328,6 +433,8 @@ void PNGLibrary::takeSnapshot(uInt32 number)
       }
       filename = buf.str();
     }
+    myLastSnapPath = sspath;
+    myLastSnapIndex = i;
   }
   else
     filename = sspath + ".png";
@@ -345,20 +452,27 @@ void PNGLibrary::takeSnapshot(uInt32 number)
   VarList::push_back(comments, "ROM MD5", myOSystem.console().properties().get(PropType::Cart_MD5));
   VarList::push_back(comments, "TV Effects", myOSystem.frameBuffer().tiaSurface().effectsInfo());
 
-  // Now create a PNG snapshot
-  string message = "Snapshot saved";
+  // Now copy the image data; compressing and writing happens in the background
+  WriteJob job;
+  job.filename = filename;
+  job.buffer = allocateWriteBuffer();
+  job.comments = comments;
+  job.level = myOSystem.settings().getInt("sscompress");
+
   if(myOSystem.settings().getBool("ss1x"))
   {
-    try
-    {
-      Common::Rect rect;
-      const FBSurface& surface = myOSystem.frameBuffer().tiaSurface().baseSurface(rect);
-      myOSystem.png().saveImage(filename, surface, rect, comments);
-    }
-    catch(const runtime_error& e)
+    Common::Rect rect;
+    const FBSurface& surface = myOSystem.frameBuffer().tiaSurface().baseSurface(rect);
+
+    job.width = rect.w();  job.height = rect.h();
+    if(rect.empty())
     {
-      message = e.what();
+      job.width = surface.width();
+      job.height = surface.height();
     }
+    // Get the surface pixel data (we get ABGR format)
+    job.buffer.resize(job.width * job.height * 4);
+    surface.readPixels(job.buffer.data(), job.width, rect);
   }
   else
   {
@@ -366,18 +480,26 @@ void PNGLibrary::takeSnapshot(uInt32 number)
     myOSystem.frameBuffer().enableMessages(false);
     myOSystem.frameBuffer().tiaSurface().renderForSnapshot();
 
-    try
-    {
-      myOSystem.png().saveImage(filename, comments);
-    }
-    catch(const runtime_error& e)
-    {
-      message = e.what();
-    }
+    readFrameBuffer(job.buffer, job.width, job.height);
 
     // Re-enable old messages
     myOSystem.frameBuffer().enableMessages(true);
   }
+  // The result is shown by reportWrittenSnapshots(), once the writer
+  // thread has processed the snapshot
+  queueImage(std::move(job));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::reportWrittenSnapshots()
+{
+  string message;
+  {
+    std::lock_guard<std::mutex> lock(myWriterMutex);
+    if(myWriterResult.empty())
+      return;
+    message.swap(myWriterResult);
+  }
   myOSystem.frameBuffer().showTextMessage(message);
 }
 
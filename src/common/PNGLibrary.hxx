@@ -21,6 +21,10 @@
 #define PNGLIBRARY_HXX
 
 #include <png.h>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
 
 class OSystem;
 class FrameBuffer;
@@ -34,6 +38,12 @@ class Properties;
   abstracts all the irrelevant details other loading and saving an
   actual image.
 
+  Snapshots are compressed and written to disk on a separate thread; only
+  copying the image data happens on the calling thread.  The number of
+  queued snapshots is limited, when the limit is reached, taking a new
+  snapshot waits until the writer thread has caught up.  The result of
+  writing a snapshot is shown once the main loop polls for it.
+
   @author  Stephen Anthony
 */
 class PNGLibrary
@@ -41,6 +51,11 @@ class PNGLibrary
   public:
     explicit PNGLibrary(OSystem& osystem);
 
+    /**
+      Waits until all queued snapshots have been written.
+    */
+    ~PNGLibrary();
+
     /**
       Read a PNG image from the specified file into a FBSurface structure,
       scaling the image to the surface bounds.
@@ -126,6 +141,12 @@ class PNGLibrary
     */
     void takeSnapshot(uInt32 number = 0);
 
+    /**
+      Show the result of the snapshots written since the last call (if any).
+      Called at regular intervals from the main loop.
+    */
+    void reportWrittenSnapshots();
+
   private:
     // Global OSystem object
     OSystem& myOSystem;
@@ -134,6 +155,34 @@ class PNGLibrary
     uInt32 mySnapInterval{0};
     uInt32 mySnapCounter{0};
 
+    // The last used snapshot base name and index, avoids probing the
+    // filesystem for all previously taken snapshots again
+    string myLastSnapPath;
+    uInt32 myLastSnapIndex{0};
+
+    // Maximum number of snapshots waiting to be written
+    static constexpr size_t MAX_QUEUED_IMAGES = 4;
+
+    // A snapshot waiting to be compressed and written by the writer thread
+    struct WriteJob {
+      string filename;
+      vector<png_byte> buffer;  // ABGR pixel data
+      png_uint_32 width{0}, height{0};
+      VariantList comments;
+      int level{0};
+    };
+
+    std::thread myWriterThread;
+    std::mutex myWriterMutex;
+    std::condition_variable myWriterWakeup, myWriterDone;
+    std::deque<WriteJob> myWriteQueue;
+    // Pixel buffers of already written snapshots, reused for new snapshots
+    vector<vector<png_byte>> myBufferPool;
+    // The message for the snapshots written since the last report; an
+    // error is kept until reported, even if later snapshots succeed
+    string myWriterResult;
+    bool myWriterQuit{false};
+
     // The following data remains between invocations of allocateStorage,
     // and is only changed when absolutely necessary.
     struct ReadInfoType {
@@ -164,10 +213,40 @@ class PNGLibrary
       @param width    The width of the PNG image
       @param height   The height of the PNG image
       @param comments The text comments to add to the PNG image
+      @param level    The zlib compression level (0 - 9)
+    */
+    static void saveImageToDisk(std::ofstream& out, const vector<png_bytep>& rows,
+                                png_uint_32 width, png_uint_32 height,
+                                const VariantList& comments, int level);
+
+    /**
+      Save the given ABGR pixel data to a PNG file.
+    */
+    static void saveBufferToDisk(const string& filename, const vector<png_byte>& buffer,
+                                 png_uint_32 width, png_uint_32 height,
+                                 const VariantList& comments, int level);
+
+    /**
+      Copy the current FrameBuffer image into the given buffer (ABGR format).
+    */
+    void readFrameBuffer(vector<png_byte>& buffer,
+                         png_uint_32& width, png_uint_32& height) const;
+
+    /**
+      Get a buffer for queueing a snapshot, waiting for a free queue slot
+      if necessary.
+    */
+    vector<png_byte> allocateWriteBuffer();
+
+    /**
+      Queue a snapshot for writing by the writer thread.
+    */
+    void queueImage(WriteJob&& job);
+
+    /**
+      The main loop of the writer thread.
     */
-    void saveImageToDisk(std::ofstream& out, const vector<png_bytep>& rows,
-                         png_uint_32 width, png_uint_32 height,
-                         const VariantList& comments);
+    void writerMain();
 
     /**
       Load the PNG data from 'ReadInfo' into the FBSurface.  The surface
@@ -180,8 +259,8 @@ class PNGLibrary
     /**
       Write PNG tEXt chunks to the image.
     */
-    void writeComments(png_structp png_ptr, png_infop info_ptr,
-                       const VariantList& comments);
+    static void writeComments(png_structp png_ptr, png_infop info_ptr,
+                              const VariantList& comments);
 
     /** PNG library callback functions */
     static void png_read_data(png_structp ctx, png_bytep area, png_size_t size);
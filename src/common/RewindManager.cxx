@@ -131,13 +131,26 @@ bool RewindManager::addState(const string& message, bool timeMachine)
   RewindState& state = myStateList.current();
   Serializer& s = state.data;
 
+  state.id = ++myLastStateId;
+  state.displayPos = 0;
+  state.thumbnail.reset();
+
   s.rewind();  // rewind Serializer internal buffers
-  if(myStateManager.saveState(s) && myOSystem.console().tia().saveDisplay(s))
+  if(myStateManager.saveState(s))
   {
-    state.message = message;
-    state.cycles = myOSystem.console().tia().cycles();
-    myLastTimeMachineAdd = timeMachine;
-    return true;
+    TIA& tia = myOSystem.console().tia();
+    // Remember where the display data starts, for creating thumbnails
+    const size_t displayPos = s.writePos();
+
+    if(tia.saveDisplay(s))
+    {
+      state.message = message;
+      state.cycles = tia.cycles();
+      state.displayPos = displayPos;
+      state.displayHeight = tia.height();
+      myLastTimeMachineAdd = timeMachine;
+      return true;
+    }
   }
   return false;
 }
@@ -332,6 +345,10 @@ string RewindManager::loadAllStates()
       s.putByteArray(buffer.get(), stateSize);
       state.message = in.getString();
       state.cycles = in.getLong();
+      // The position of the display data is unknown, so no thumbnails
+      state.id = ++myLastStateId;
+      state.displayPos = 0;
+      state.thumbnail.reset();
     }
 
     // initialize current state (parameters ignored)
@@ -472,3 +489,67 @@ IntArray RewindManager::cyclesList() const
 
   return arr;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RewindManager::requestThumbnails(uInt32 first, uInt32 last)
+{
+  ByteArray frame;
+  uInt32 idx = 0;
+
+  for(auto it = myStateList.begin(); it != myStateList.end() && idx <= last; ++it, ++idx)
+  {
+    RewindState& state = *it;
+
+    if(idx < first || state.thumbnail || state.displayPos == 0 ||
+       myThumbnails.isPending(state.id))
+      continue;
+
+    const uInt32 height = std::min(state.displayHeight, TIAConstants::frameBufferHeight);
+    frame.resize(size_t(TIAConstants::H_PIXEL) * height);
+
+    try
+    {
+      // The displayed frame buffer is the first item of the display data
+      Serializer& s = state.data;
+      s.seekRead(state.displayPos);
+      s.getByteArray(frame.data(), frame.size());
+      s.rewind();
+    }
+    catch(...)
+    {
+      state.displayPos = 0;
+      continue;
+    }
+    myThumbnails.request(state.id, frame.data(), height);
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RewindManager::updateThumbnails()
+{
+  std::vector<std::pair<uInt64, shared_ptr<Thumbnail>>> finished;
+
+  if(!myThumbnails.collect(finished))
+    return false;
+
+  bool updated = false;
+  for(auto& state: myStateList)
+    for(auto& result: finished)
+      if(result.first == state.id)
+      {
+        state.thumbnail = std::move(result.second);
+        updated = true;
+        break;
+      }
+
+  return updated;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<const RewindManager::Thumbnail> RewindManager::thumbnail(uInt32 idx) const
+{
+  if(idx >= myStateList.size())
+    return nullptr;
+
+  return std::next(myStateList.cbegin(), idx)->thumbnail;
+}
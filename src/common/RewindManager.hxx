@@ -22,6 +22,7 @@ class OSystem;
 class StateManager;
 
 #include "LinkedObjectPool.hxx"
+#include "ThumbnailGenerator.hxx"
 #include "bspf.hxx"
 
 /**
@@ -41,6 +42,10 @@ class StateManager;
   If the list is full, states are either removed at the beginning (compression
   off) or at selective positions (compression on).
 
+  For each state, a downscaled thumbnail of the TIA frame can be created on
+  demand.  This happens on a separate thread, directly from the display data
+  stored within the state, so the emulation state never has to be loaded.
+
   @author  Stephen Anthony
 */
 class RewindManager
@@ -145,6 +150,7 @@ class RewindManager
     void resize(uInt32 size) { myStateList.resize(size); }
     void clear() {
       myStateList.clear();
+      myThumbnails.clear();
     }
 
     /**
@@ -166,6 +172,26 @@ class RewindManager
     */
     IntArray cyclesList() const;
 
+    using Thumbnail = ThumbnailGenerator::Thumbnail;
+
+    /**
+      Request thumbnails for the given range of states (0-based, inclusive).
+      States which already have a thumbnail or a pending request are skipped.
+    */
+    void requestThumbnails(uInt32 first, uInt32 last);
+
+    /**
+      Assign all thumbnails finished in the meantime to their states.
+
+      @return  Whether any new thumbnails have become available
+    */
+    bool updateThumbnails();
+
+    /**
+      Get the thumbnail of the given state (0-based), if already available.
+    */
+    shared_ptr<const Thumbnail> thumbnail(uInt32 idx) const;
+
   private:
     OSystem& myOSystem;
     StateManager& myStateManager;
@@ -176,12 +202,18 @@ class RewindManager
     uInt64 myHorizon{0};
     double myFactor{0.0};
     bool   myLastTimeMachineAdd{false};
+    uInt64 myLastStateId{0};
 
     struct RewindState {
       Serializer data;  // actual save state
       string message;   // describes save state origin
       uInt64 cycles{0}; // cycles since emulation started
 
+      uInt64 id{0};            // unique id, used for thumbnail requests
+      size_t displayPos{0};    // start of the TIA display data (0 = unknown)
+      uInt32 displayHeight{0}; // number of valid scanlines in the display data
+      shared_ptr<const Thumbnail> thumbnail;
+
       // We do nothing on object instantiation or copy
       // The goal of LinkedObjectPool is to not do any allocations at all
       RewindState() = default;
@@ -198,6 +230,9 @@ class RewindManager
     // frequent (de)-allocations)
     Common::LinkedObjectPool<RewindState> myStateList;
 
+    // Creates the thumbnails of the states
+    ThumbnailGenerator myThumbnails;
+
     /**
       Remove a save state from the list
     */
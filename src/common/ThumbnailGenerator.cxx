@@ -0,0 +1,182 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "TIAConstants.hxx"
+#include "ThumbnailGenerator.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ThumbnailGenerator::ThumbnailGenerator()
+{
+  myThread = std::thread(&ThumbnailGenerator::threadMain, this);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ThumbnailGenerator::~ThumbnailGenerator()
+{
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+
+    myQuit = true;
+    myJobs.clear();
+  }
+  myWakeupCondition.notify_one();
+
+  myThread.join();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailGenerator::request(uInt64 id, const uInt8* frame, uInt32 height)
+{
+  height = std::min(height, TIAConstants::frameBufferHeight);
+  if(height < V_SCALE)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+
+    Job job;
+    job.id = id;
+    job.height = height;
+    if(!myFramePool.empty())
+    {
+      job.frame = std::move(myFramePool.back());
+      myFramePool.pop_back();
+    }
+    job.frame.assign(frame, frame + size_t(TIAConstants::H_PIXEL) * height);
+
+    myJobs.push_back(std::move(job));
+  }
+  myWakeupCondition.notify_one();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ThumbnailGenerator::isPending(uInt64 id) const
+{
+  std::lock_guard<std::mutex> lock(myMutex);
+
+  if(myActive && myActiveId == id)
+    return true;
+  for(const auto& job: myJobs)
+    if(job.id == id)
+      return true;
+  for(const auto& result: myFinished)
+    if(result.first == id)
+      return true;
+
+  return false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ThumbnailGenerator::collect(
+    std::vector<std::pair<uInt64, shared_ptr<Thumbnail>>>& finished)
+{
+  std::lock_guard<std::mutex> lock(myMutex);
+
+  if(myFinished.empty())
+    return false;
+
+  for(auto& result: myFinished)
+    finished.push_back(std::move(result));
+  myFinished.clear();
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailGenerator::clear()
+{
+  std::lock_guard<std::mutex> lock(myMutex);
+
+  for(auto& job: myJobs)
+    myFramePool.push_back(std::move(job.frame));
+  myJobs.clear();
+  myFinished.clear();
+  // A job which is currently processed will be dropped when it finishes
+  myActive = false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailGenerator::threadMain()
+{
+  std::unique_lock<std::mutex> lock(myMutex);
+
+  while(true)
+  {
+    myWakeupCondition.wait(lock, [this]{ return myQuit || !myJobs.empty(); });
+    if(myQuit)
+      break;
+
+    Job job = std::move(myJobs.front());
+    myJobs.pop_front();
+    myActiveId = job.id;
+    myActive = true;
+
+    // Downscaling happens without holding the lock
+    lock.unlock();
+    shared_ptr<Thumbnail> thumbnail = downscale(job.frame, job.height);
+    lock.lock();
+
+    // Results of jobs cleared in the meantime are dropped
+    if(myActive && myActiveId == job.id)
+      myFinished.emplace_back(job.id, std::move(thumbnail));
+    myActive = false;
+    myFramePool.push_back(std::move(job.frame));
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<ThumbnailGenerator::Thumbnail>
+ThumbnailGenerator::downscale(const ByteArray& frame, uInt32 height)
+{
+  shared_ptr<Thumbnail> thumbnail = make_shared<Thumbnail>();
+  thumbnail->width = TIAConstants::H_PIXEL / H_SCALE;
+  thumbnail->height = height / V_SCALE;
+  thumbnail->pixels.resize(size_t(thumbnail->width) * thumbnail->height);
+
+  std::array<uInt8, H_SCALE * V_SCALE> block;
+  uInt8* dst = thumbnail->pixels.data();
+
+  for(uInt32 y = 0; y < thumbnail->height; ++y)
+  {
+    const uInt8* src = frame.data() + size_t(y) * V_SCALE * TIAConstants::H_PIXEL;
+
+    for(uInt32 x = 0; x < thumbnail->width; ++x, src += H_SCALE)
+    {
+      // Use the most frequent color of each block; this keeps the colors of
+      // larger objects intact, whereas averaging would create colors which
+      // are not part of the palette
+      for(uInt32 by = 0; by < V_SCALE; ++by)
+        for(uInt32 bx = 0; bx < H_SCALE; ++bx)
+          block[by * H_SCALE + bx] = src[by * TIAConstants::H_PIXEL + bx];
+
+      uInt8 color = block[0];
+      uInt32 maxCount = 0;
+      for(uInt32 i = 0; i < block.size(); ++i)
+      {
+        const uInt32 count = uInt32(std::count(block.cbegin(), block.cend(), block[i]));
+        if(count > maxCount)
+        {
+          maxCount = count;
+          color = block[i];
+        }
+      }
+      *dst++ = color;
+    }
+  }
+
+  return thumbnail;
+}
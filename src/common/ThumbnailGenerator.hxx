@@ -0,0 +1,122 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef THUMBNAIL_GENERATOR_HXX
+#define THUMBNAIL_GENERATOR_HXX
+
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+
+#include "bspf.hxx"
+
+/**
+  This class creates downscaled copies of TIA frames on a separate thread.
+  The frames are passed as indexed TIA colors and the resulting thumbnails
+  keep using indexed colors, so they can be drawn with the current palette.
+
+  Frames are identified by a caller-defined id; finished thumbnails are
+  collected by the caller (normally the main thread) by polling.
+*/
+class ThumbnailGenerator
+{
+  public:
+    // Horizontal and vertical downscale factors
+    static constexpr uInt32 H_SCALE = 2, V_SCALE = 4;
+
+    struct Thumbnail {
+      uInt32 width{0};
+      uInt32 height{0};
+      ByteArray pixels;  // indexed TIA colors, width * height
+    };
+
+    /**
+      The constructor starts the worker thread.
+    */
+    ThumbnailGenerator();
+
+    /**
+      The destructor discards all pending requests and stops the worker thread.
+    */
+    ~ThumbnailGenerator();
+
+    /**
+      Queue a frame for downscaling.  The frame data is copied, so the caller
+      can discard or overwrite it immediately.
+
+      @param id      The id used to identify the resulting thumbnail
+      @param frame   The indexed frame data (TIAConstants::H_PIXEL wide)
+      @param height  The number of valid scanlines in the frame
+    */
+    void request(uInt64 id, const uInt8* frame, uInt32 height);
+
+    /**
+      Answer whether the given id has been requested and is not yet collected.
+    */
+    bool isPending(uInt64 id) const;
+
+    /**
+      Move all finished thumbnails into the given container.
+
+      @return  Whether any thumbnails were collected
+    */
+    bool collect(std::vector<std::pair<uInt64, shared_ptr<Thumbnail>>>& finished);
+
+    /**
+      Discard all pending requests and uncollected results.
+    */
+    void clear();
+
+  private:
+    void threadMain();
+
+    /**
+      Downscale a single frame (runs on the worker thread).
+    */
+    static shared_ptr<Thumbnail> downscale(const ByteArray& frame, uInt32 height);
+
+  private:
+    struct Job {
+      uInt64 id{0};
+      uInt32 height{0};
+      ByteArray frame;
+    };
+
+    std::thread myThread;
+    mutable std::mutex myMutex;
+    std::condition_variable myWakeupCondition;
+    bool myQuit{false};
+
+    std::deque<Job> myJobs;
+    std::vector<std::pair<uInt64, shared_ptr<Thumbnail>>> myFinished;
+    // The id currently processed by the worker thread
+    uInt64 myActiveId{0};
+    bool myActive{false};
+
+    // Frame buffers of finished jobs, reused to avoid reallocations
+    std::vector<ByteArray> myFramePool;
+
+  private:
+    // Following constructors and assignment operators not supported
+    ThumbnailGenerator(const ThumbnailGenerator&) = delete;
+    ThumbnailGenerator(ThumbnailGenerator&&) = delete;
+    ThumbnailGenerator& operator=(const ThumbnailGenerator&) = delete;
+    ThumbnailGenerator& operator=(ThumbnailGenerator&&) = delete;
+};
+
+#endif
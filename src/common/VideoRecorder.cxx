@@ -0,0 +1,393 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include <cmath>
+
+#include "OSystem.hxx"
+#include "Console.hxx"
+#include "FrameBuffer.hxx"
+#include "Settings.hxx"
+#include "AudioSettings.hxx"
+#include "TIA.hxx"
+#include "TIAConstants.hxx"
+#include "Props.hxx"
+#include "VideoRecorder.hxx"
+
+namespace {
+  template<typename T>
+  void writeLE(std::ofstream& out, T value)
+  {
+    for(size_t i = 0; i < sizeof(T); ++i)
+      out.put(char((uInt64(value) >> (i * 8)) & 0xff));
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+VideoRecorder::VideoRecorder(OSystem& osystem)
+  : myOSystem{osystem}
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+VideoRecorder::~VideoRecorder()
+{
+  stop();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::toggleRecording()
+{
+  if(myIsRecording)
+  {
+    ostringstream buf;
+    const string name = myBaseName;
+    stop();
+    buf << "Recording stopped, " << myFrameCount << " frames saved to '"
+        << FilesystemNode(name).getName() << "'";
+    myOSystem.frameBuffer().showTextMessage(buf.str());
+    return;
+  }
+  if(!myOSystem.hasConsole())
+    return;
+
+#ifdef PNG_SUPPORT
+  const FilesystemNode& dir = myOSystem.snapshotSaveDir();
+#else
+  const FilesystemNode& dir = myOSystem.userDir();
+#endif
+  const string path = dir.getPath() +
+      (myOSystem.settings().getString("snapname") != "int" ?
+          myOSystem.romFile().getNameWithExt("")
+        : myOSystem.console().properties().get(PropType::Cart_Name));
+
+  // Find the first name which is not used yet
+  string basename = path;
+  for(uInt32 i = 1; FilesystemNode(basename + ".s2v").exists(); ++i)
+    basename = path + "_" + std::to_string(i);
+
+  const string error = start(basename);
+  if(error.empty())
+    myOSystem.frameBuffer().showTextMessage("Recording started");
+  else
+    myOSystem.frameBuffer().showTextMessage(error);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string VideoRecorder::start(const string& basename)
+{
+  if(myIsRecording || !myOSystem.hasConsole())
+    return "Recording not possible";
+
+  Console& console = myOSystem.console();
+
+  myVideoFile.open(basename + ".s2v", std::ios::binary | std::ios::trunc);
+  myAudioFile.open(basename + ".wav", std::ios::binary | std::ios::trunc);
+  if(!myVideoFile.is_open() || !myAudioFile.is_open())
+  {
+    myVideoFile.close();
+    myAudioFile.close();
+    return "Recording files could not be created";
+  }
+
+  // Use the same channel layout the audio queue uses; the TIA produces one
+  // sample per 38 CPU cycles, so like the video frame rate, the sample rate
+  // must not be scaled by the emulation speed
+  myChannels =
+    (myOSystem.settings().getBool(AudioSettings::SETTING_STEREO) ||
+     console.properties().get(PropType::Cart_Sound) == "STEREO") ? 2 : 1;
+  const uInt32 sampleRate = console.emulationTiming().nativeAudioSampleRate();
+
+  myVideoFile.write("STLAVID1", 8);
+  writeLE<uInt16>(myVideoFile, TIAConstants::H_PIXEL);
+  writeLE<uInt32>(myVideoFile, uInt32(std::round(myOSystem.frameRate() * 1000)));
+
+  // The RIFF and data chunk sizes are completed when recording stops
+  myAudioFile.write("RIFF", 4);
+  writeLE<uInt32>(myAudioFile, 0);
+  myAudioFile.write("WAVEfmt ", 8);
+  writeLE<uInt32>(myAudioFile, 16);
+  writeLE<uInt16>(myAudioFile, 1);  // PCM
+  writeLE<uInt16>(myAudioFile, myChannels);
+  writeLE<uInt32>(myAudioFile, sampleRate);
+  writeLE<uInt32>(myAudioFile, sampleRate * myChannels * 2);
+  writeLE<uInt16>(myAudioFile, myChannels * 2);
+  writeLE<uInt16>(myAudioFile, 16);
+  myAudioFile.write("data", 4);
+  writeLE<uInt32>(myAudioFile, 0);
+
+  myBaseName = basename;
+  myPrevHeight = myFrameCount = myFramesSinceKey = 0;
+  myAudioBytes = 0;
+  myWriteError = false;
+  myWriterQuit = false;
+  myIsRecording = true;
+  myWriterThread = std::thread(&VideoRecorder::writerMain, this);
+
+  setPalette(myPalette);
+
+  // Emulation is not running here, so the callbacks can be safely installed
+  myTIA = &console.tia();
+  myTIA->setFrameCallback([this](const uInt8* frame, uInt32 height) {
+    addFrame(frame, height);
+  });
+  myTIA->setAudioCallback([this](const Int16* fragment, uInt32 samples, bool isStereo) {
+    addAudio(fragment, samples, isStereo);
+  });
+
+  return EmptyString;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::stop()
+{
+  if(!myIsRecording)
+    return;
+
+  myTIA->setFrameCallback(nullptr);
+  myTIA->setAudioCallback(nullptr);
+  myTIA = nullptr;
+
+  // Queued data is still written before the thread quits
+  {
+    std::lock_guard<std::mutex> lock(myWriterMutex);
+    myWriterQuit = true;
+  }
+  myWriterWakeup.notify_one();
+  myWriterThread.join();
+
+  finishFiles();
+  myPacketPool.clear();
+  myIsRecording = false;
+
+  if(myWriteError)
+    Logger::error("ERROR: writing recording '" + myBaseName + "' failed");
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::setPalette(const PaletteArray& rgb_palette)
+{
+  myPalette = rgb_palette;
+
+  if(!myIsRecording)
+    return;
+
+  Packet packet = allocatePacket(PacketType::palette);
+  packet.video.resize(myPalette.size() * 3);
+  for(size_t i = 0; i < myPalette.size(); ++i)
+  {
+    packet.video[i * 3 + 0] = (myPalette[i] >> 16) & 0xff;
+    packet.video[i * 3 + 1] = (myPalette[i] >> 8) & 0xff;
+    packet.video[i * 3 + 2] = myPalette[i] & 0xff;
+  }
+  queuePacket(std::move(packet));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::addFrame(const uInt8* frame, uInt32 height)
+{
+  Packet packet = allocatePacket(PacketType::frame);
+  packet.height = height;
+  packet.video.assign(frame, frame + size_t(TIAConstants::H_PIXEL) * height);
+  queuePacket(std::move(packet));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::addAudio(const Int16* fragment, uInt32 samples, bool isStereo)
+{
+  Packet packet = allocatePacket(PacketType::audio);
+  packet.audio.resize(size_t(samples) * myChannels);
+
+  // The stereo setting may change while recording; convert to the
+  // channel layout of the file
+  if(isStereo == (myChannels == 2))
+    std::copy_n(fragment, packet.audio.size(), packet.audio.begin());
+  else if(isStereo)
+    for(uInt32 i = 0; i < samples; ++i)
+      packet.audio[i] = Int16((Int32(fragment[i * 2]) + fragment[i * 2 + 1]) / 2);
+  else
+    for(uInt32 i = 0; i < samples; ++i)
+      packet.audio[i * 2] = packet.audio[i * 2 + 1] = fragment[i];
+
+  queuePacket(std::move(packet));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+VideoRecorder::Packet VideoRecorder::allocatePacket(PacketType type)
+{
+  std::unique_lock<std::mutex> lock(myWriterMutex);
+
+  // Apply backpressure; emulation waits for the writer instead of
+  // dropping data
+  myWriterDone.wait(lock, [this]{ return myQueue.size() < MAX_QUEUED_PACKETS; });
+
+  Packet packet;
+  if(!myPacketPool.empty())
+  {
+    packet = std::move(myPacketPool.back());
+    myPacketPool.pop_back();
+  }
+  packet.type = type;
+  return packet;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::queuePacket(Packet&& packet)
+{
+  {
+    std::lock_guard<std::mutex> lock(myWriterMutex);
+    myQueue.push_back(std::move(packet));
+  }
+  myWriterWakeup.notify_one();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::writerMain()
+{
+  std::unique_lock<std::mutex> lock(myWriterMutex);
+
+  while(true)
+  {
+    myWriterWakeup.wait(lock, [this]{ return myWriterQuit || !myQueue.empty(); });
+    if(myQueue.empty())  // only quit when all data is written
+      break;
+
+    Packet packet = std::move(myQueue.front());
+    myQueue.pop_front();
+
+    // Compress and write without holding the lock
+    lock.unlock();
+    writePacket(packet);
+    lock.lock();
+
+    myPacketPool.push_back(std::move(packet));
+    myWriterDone.notify_one();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::writePacket(Packet& packet)
+{
+  switch(packet.type)
+  {
+    case PacketType::palette:
+      writeRecord('P', uInt32(packet.video.size()));
+      myVideoFile.write(reinterpret_cast<const char*>(packet.video.data()),
+                        packet.video.size());
+      break;
+
+    case PacketType::frame:
+    {
+      // Consecutive frames differ very little, so the XOR with the previous
+      // frame consists mostly of zeros, which compress very well
+      const bool isKey = packet.height != myPrevHeight ||
+                         myFramesSinceKey >= KEY_FRAME_INTERVAL;
+      const size_t size = packet.video.size();
+
+      myCompressed.clear();
+      if(isKey)
+      {
+        packBits(packet.video.data(), size, myCompressed);
+        myFramesSinceKey = 0;
+      }
+      else
+      {
+        myDeltaFrame.resize(size);
+        for(size_t i = 0; i < size; ++i)
+          myDeltaFrame[i] = packet.video[i] ^ myPrevFrame[i];
+        packBits(myDeltaFrame.data(), size, myCompressed);
+      }
+      writeRecord(isKey ? 'K' : 'D', uInt32(myCompressed.size() + 2));
+      writeLE<uInt16>(myVideoFile, packet.height);
+      myVideoFile.write(reinterpret_cast<const char*>(myCompressed.data()),
+                        myCompressed.size());
+
+      myPrevFrame.swap(packet.video);
+      myPrevHeight = packet.height;
+      ++myFramesSinceKey;
+      ++myFrameCount;
+      break;
+    }
+
+    case PacketType::audio:
+      for(const Int16 sample: packet.audio)
+        writeLE<uInt16>(myAudioFile, uInt16(sample));
+      myAudioBytes += packet.audio.size() * 2;
+      break;
+  }
+
+  if(!myVideoFile.good() || !myAudioFile.good())
+    myWriteError = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::writeRecord(char type, uInt32 size)
+{
+  myVideoFile.put(type);
+  writeLE<uInt32>(myVideoFile, size);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::finishFiles()
+{
+  writeRecord('E', 4);
+  writeLE<uInt32>(myVideoFile, myFrameCount);
+
+  // WAV files are limited to 4GB, the sizes are clamped accordingly
+  const uInt32 dataSize = uInt32(std::min<uInt64>(myAudioBytes, 0xffffffff - 36));
+  myAudioFile.seekp(4);
+  writeLE<uInt32>(myAudioFile, dataSize + 36);
+  myAudioFile.seekp(40);
+  writeLE<uInt32>(myAudioFile, dataSize);
+
+  if(!myVideoFile.good() || !myAudioFile.good())
+    myWriteError = true;
+
+  myVideoFile.close();
+  myAudioFile.close();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void VideoRecorder::packBits(const uInt8* data, size_t size, ByteArray& out)
+{
+  size_t i = 0;
+
+  while(i < size)
+  {
+    // Runs of at least three equal bytes are stored as repeats
+    size_t run = 1;
+    while(i + run < size && run < 128 && data[i + run] == data[i])
+      ++run;
+    if(run >= 3)
+    {
+      out.push_back(uInt8(257 - run));
+      out.push_back(data[i]);
+      i += run;
+      continue;
+    }
+
+    // Everything else is stored as literals, up to the next run
+    const size_t start = i;
+    while(i < size && i - start < 128)
+    {
+      if(i + 2 < size && data[i] == data[i + 1] && data[i] == data[i + 2])
+        break;
+      ++i;
+    }
+    out.push_back(uInt8(i - start - 1));
+    out.insert(out.end(), data + start, data + i);
+  }
+}
@@ -0,0 +1,203 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef VIDEO_RECORDER_HXX
+#define VIDEO_RECORDER_HXX
+
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <fstream>
+
+class OSystem;
+class TIA;
+
+#include "FrameBufferConstants.hxx"
+#include "bspf.hxx"
+
+/**
+  This class records the raw emulator output (every TIA frame and every
+  audio sample) losslessly.  Frames and audio are taken directly from the
+  TIA on the emulation thread, so frame skipping, scaling and filtering do
+  not affect the recording.  Only copying happens on the emulation thread;
+  compression and disk I/O are done on a separate thread.
+
+  Each recording consists of two files:
+
+  - '<name>.s2v' contains the video as palette indices.  The file starts
+    with the 8 byte signature "STLAVID1", followed by the frame width
+    (uInt16) and the frame rate in millihertz (uInt32).  Then a sequence of
+    records follows, each made of a type byte and the payload size (uInt32):
+      'P'  palette: 256 RGB triplets
+      'K'  key frame: height (uInt16), PackBits compressed color indices
+      'D'  delta frame: height (uInt16), PackBits compressed XOR of the
+           color indices with the previous frame
+      'E'  end of recording: number of frames (uInt32)
+    All values are stored little endian.
+
+  - '<name>.wav' contains the audio as 16 bit PCM at the native TIA rate.
+*/
+class VideoRecorder
+{
+  public:
+    explicit VideoRecorder(OSystem& osystem);
+
+    /**
+      Finishes a running recording.
+    */
+    ~VideoRecorder();
+
+    /**
+      Start or stop recording the current console, and inform the user.
+    */
+    void toggleRecording();
+
+    /**
+      Start recording the current console into files with the given base
+      name (without extension).
+
+      @return  An error message, or an empty string on success
+    */
+    string start(const string& basename);
+
+    /**
+      Stop recording; waits until all queued data has been written.
+    */
+    void stop();
+
+    /**
+      Answer whether a recording is running.
+    */
+    bool isRecording() const { return myIsRecording; }
+
+    /**
+      Update the palette used to convert the color indices.  This is called
+      whenever the TIA palette changes, even when not recording.
+    */
+    void setPalette(const PaletteArray& rgb_palette);
+
+  private:
+    // The type of data in a packet, also the record type in the video file
+    enum class PacketType: uInt8 {
+      palette = 'P',
+      frame   = 'K',  // the writer decides about key and delta frames
+      audio   = 'A'
+    };
+
+    struct Packet {
+      PacketType type{PacketType::frame};
+      uInt32 height{0};
+      ByteArray video;
+      vector<Int16> audio;
+    };
+
+    /**
+      Called on the emulation thread for every finished frame.
+    */
+    void addFrame(const uInt8* frame, uInt32 height);
+
+    /**
+      Called on the emulation thread for every finished audio fragment.
+    */
+    void addAudio(const Int16* fragment, uInt32 samples, bool isStereo);
+
+    /**
+      Get a packet from the pool, waits if too many packets are queued.
+    */
+    Packet allocatePacket(PacketType type);
+
+    /**
+      Hand a packet to the writer thread.
+    */
+    void queuePacket(Packet&& packet);
+
+    /**
+      Main loop of the writer thread.
+    */
+    void writerMain();
+
+    /**
+      Write a single packet to the video or audio file (writer thread).
+    */
+    void writePacket(Packet& packet);
+
+    /**
+      Write a record header to the video file.
+    */
+    void writeRecord(char type, uInt32 size);
+
+    /**
+      Complete the headers and close the files.
+    */
+    void finishFiles();
+
+    /**
+      Compress data using the PackBits scheme: A control byte n in
+      0..127 is followed by n+1 literal bytes, a control byte n in 129..255
+      is followed by one byte which is repeated 257-n times.
+    */
+    static void packBits(const uInt8* data, size_t size, ByteArray& out);
+
+  private:
+    // The parent system for the recorder
+    OSystem& myOSystem;
+
+    bool myIsRecording{false};
+    string myBaseName;
+
+    // The TIA which is recorded (it must not be destroyed while recording)
+    TIA* myTIA{nullptr};
+
+    // The current RGB palette, sent with the start of each recording
+    PaletteArray myPalette{0};
+
+    // Number of audio channels in the WAV file
+    uInt32 myChannels{1};
+
+    // Data from the emulation thread waiting to be written
+    std::thread myWriterThread;
+    std::mutex myWriterMutex;
+    std::condition_variable myWriterWakeup, myWriterDone;
+    std::deque<Packet> myQueue;
+    vector<Packet> myPacketPool;
+    bool myWriterQuit{false};
+
+    // The following are only accessed by the writer thread while recording
+    std::ofstream myVideoFile, myAudioFile;
+    ByteArray myPrevFrame, myDeltaFrame, myCompressed;
+    uInt32 myPrevHeight{0};
+    uInt32 myFrameCount{0}, myFramesSinceKey{0};
+    uInt64 myAudioBytes{0};
+    bool myWriteError{false};
+
+    // The number of queued packets before the emulation thread has to wait
+    static constexpr size_t MAX_QUEUED_PACKETS = 64;
+
+    // Write a key frame at least this often, to allow seeking
+    static constexpr uInt32 KEY_FRAME_INTERVAL = 300;
+
+  private:
+    // Following constructors and assignment operators not supported
+    VideoRecorder() = delete;
+    VideoRecorder(const VideoRecorder&) = delete;
+    VideoRecorder(VideoRecorder&&) = delete;
+    VideoRecorder& operator=(const VideoRecorder&) = delete;
+    VideoRecorder& operator=(VideoRecorder&&) = delete;
+};
+
+#endif
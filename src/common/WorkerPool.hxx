@@ -0,0 +1,220 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef WORKER_POOL_HXX
+#define WORKER_POOL_HXX
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "bspf.hxx"
+
+namespace Common {
+
+/**
+  A fixed set of worker threads, which run the tasks submitted to the pool
+  in order and queue their results until they are collected.  Tasks can
+  submit further tasks themselves (ie, when walking a directory tree).
+
+  Tasks run without holding any lock, so they must only access data which
+  is either not shared or immutable while the pool exists.  Everything
+  else is left to the thread collecting the results.
+*/
+template<typename Result>
+class WorkerPool
+{
+  public:
+    using Task = std::function<Result()>;
+
+    /**
+      Create the pool and start its worker threads.
+
+      @param numThreads  The number of worker threads (at least one)
+    */
+    explicit WorkerPool(uInt32 numThreads)
+    {
+      numThreads = std::max(numThreads, 1U);
+      for(uInt32 i = 0; i < numThreads; ++i)
+        myThreads.emplace_back(&WorkerPool::threadMain, this);
+    }
+
+    /**
+      The destructor stops the pool and waits for all worker threads.
+    */
+    ~WorkerPool()
+    {
+      stop();
+
+      for(auto& thread: myThreads)
+        thread.join();
+    }
+
+    /**
+      Add a task to the end of the queue.  Tasks submitted after the pool
+      was stopped are dropped.
+    */
+    void submit(Task task)
+    {
+      {
+        std::lock_guard<std::mutex> lock(myMutex);
+
+        if(myStopped)
+          return;
+        myTasks.push_back(std::move(task));
+      }
+      myWorkCondition.notify_one();
+    }
+
+    /**
+      Drop all tasks which haven't been started yet.  The results of the
+      tasks currently running are still queued.
+    */
+    void clear()
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+
+      myTasks.clear();
+    }
+
+    /**
+      Drop all queued tasks and results, and stop the worker threads once
+      their current tasks are done; the results of these are discarded.
+      A stopped pool is idle and can't be restarted.
+    */
+    void stop()
+    {
+      {
+        std::lock_guard<std::mutex> lock(myMutex);
+
+        myStopped = true;
+        myTasks.clear();
+        myResults.clear();
+      }
+      myWorkCondition.notify_all();
+      myResultCondition.notify_all();
+    }
+
+    /**
+      Answer whether all tasks submitted so far are done.  Results may
+      still be waiting to be collected.
+    */
+    bool isIdle() const
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+
+      return idle();
+    }
+
+    /**
+      Wait until results are available or the pool is idle (or the timeout
+      expired), and append all queued results to the given list.
+
+      @param results  The list to append the results to
+      @param timeout  The maximum time to wait (in ms); zero doesn't wait
+
+      @return  False if the pool is idle and all results were collected
+    */
+    bool collect(std::vector<Result>& results, uInt32 timeout = 0)
+    {
+      std::unique_lock<std::mutex> lock(myMutex);
+
+      if(timeout > 0)
+        myResultCondition.wait_for(lock, std::chrono::milliseconds(timeout),
+            [this]{ return !myResults.empty() || idle(); });
+
+      const bool collected = !myResults.empty();
+      for(auto& result: myResults)
+        results.push_back(std::move(result));
+      myResults.clear();
+
+      return collected || !idle();
+    }
+
+    /**
+      The number of threads to use for the given kind of work, based on
+      the number of cores in the system.
+
+      @param minThreads  The minimum number of threads
+      @param maxThreads  The maximum number of threads
+    */
+    static uInt32 threadCount(uInt32 minThreads, uInt32 maxThreads) {
+      return BSPF::clamp(std::thread::hardware_concurrency(), minThreads, maxThreads);
+    }
+
+  private:
+    void threadMain()
+    {
+      std::unique_lock<std::mutex> lock(myMutex);
+
+      while(true)
+      {
+        myWorkCondition.wait(lock, [this]{ return myStopped || !myTasks.empty(); });
+        if(myStopped)
+          break;
+
+        Task task = std::move(myTasks.front());
+        myTasks.pop_front();
+        ++myBusy;
+
+        // Running the task happens without holding the lock
+        lock.unlock();
+        Result result = task();
+        lock.lock();
+
+        --myBusy;
+        if(!myStopped)
+          myResults.push_back(std::move(result));
+
+        // Wake up the collector for the new result (or because the pool
+        // has become idle)
+        myResultCondition.notify_all();
+      }
+    }
+
+    // Answer whether all tasks are done (must hold the lock)
+    bool idle() const { return myStopped || (myTasks.empty() && myBusy == 0); }
+
+  private:
+    std::vector<std::thread> myThreads;
+    mutable std::mutex myMutex;
+    std::condition_variable myWorkCondition;
+    std::condition_variable myResultCondition;
+    bool myStopped{false};
+
+    // Tasks not started yet, and number of tasks currently running
+    std::deque<Task> myTasks;
+    uInt32 myBusy{0};
+
+    // Results not collected yet
+    std::deque<Result> myResults;
+
+  private:
+    // Following constructors and assignment operators not supported
+    WorkerPool() = delete;
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool& operator=(WorkerPool&&) = delete;
+};
+
+} // namespace Common
+
+#endif
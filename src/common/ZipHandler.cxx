@@ -20,52 +20,36 @@
 #include <zlib.h>
 
 #include "Bankswitch.hxx"
+#include "FSNodeFactory.hxx"
 #include "ZipHandler.hxx"
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::open(const string& filename)
 {
-  // Close already open file (if any) and add to cache
-  addToCache();
-
   // Ensure we start with a nullptr result
   myZip.reset();
-
-  ZipFilePtr ptr = findCached(filename);
-  if(ptr)
-  {
-    // Only a previously used entry will exist in the cache, so we know it's valid
-    myZip = std::move(ptr);
-
-    // Was already initialized; we just need to re-open it
-    if(!myZip->open())
-      throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-  }
+  myFilename = filename;
+
+  // Only read the central directory again if the file has changed
+  const auto node = FilesystemNodeFactory::create(filename,
+      FilesystemNodeFactory::Type::SYSTEM);
+  const uInt64 modified = node->getLastModified();
+  const uInt64 length = node->getSize();
+
+  const auto iter = myIndex.find(filename);
+  if(iter != myIndex.end() && iter->second->modified == modified &&
+     iter->second->length == length)
+    myZip = iter->second;
   else
   {
-    // Allocate memory for the ZipFile structure
-    ptr = make_unique<ZipFile>(filename);
-    if(ptr == nullptr)
-      throw runtime_error(errorMessage(ZipError::OUT_OF_MEMORY));
-
-    // Open the file and initialize it
-    if(!ptr->open())
-      throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-    try
-    {
-      ptr->initialize();
-    }
-    catch(...)
-    {
-      throw;
-    }
+    myIndex.erase(filename);
 
-    myZip = std::move(ptr);
+    ZipIndexPtr index = readIndex(filename);
+    index->modified = modified;
+    index->length = length;
+    myIndex.emplace(filename, index);
 
-    // Count ROM files (we do it here so it will be cached)
-    while(hasNext())
-      if(Bankswitch::isValidRomName(next()))
-        myZip->myRomfiles++;
+    myZip = std::move(index);
   }
 
   reset();  // Reset iterator to beginning for subsequent use
@@ -75,43 +59,41 @@ void ZipHandler::open(const string& filename)
 void ZipHandler::reset()
 {
   // Reset the position and go from there
-  if(myZip)
-    myZip->myCdPos = 0;
+  myPos = 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool ZipHandler::hasNext() const
 {
-  return myZip && (myZip->myCdPos < myZip->myEcd.cdSize);
+  return myZip && myPos < myZip->headers.size();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 const string& ZipHandler::next()
 {
-  if(hasNext())
-  {
-    const ZipHeader* header = myZip->nextFile();
-    if(!header || header->uncompressedLength == 0)
-      return next();
-    else
-      return header->filename;
-  }
-  return EmptyString;
+  return hasNext() ? myZip->headers[myPos++].filename : EmptyString;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt64 ZipHandler::decompress(ByteBuffer& image)
 {
-  if(myZip && myZip->myHeader.uncompressedLength > 0)
+  // Decompress the file most recently returned by next()
+  if(myZip && myPos > 0)
   {
-    uInt64 length = myZip->myHeader.uncompressedLength;
+    ZipFile zip(myFilename);
+    zip.myEcd = myZip->ecd;
+    zip.myHeader = myZip->headers[myPos - 1];
+    if(!zip.open())
+      throw runtime_error(errorMessage(ZipError::FILE_ERROR));
+
+    uInt64 length = zip.myHeader.uncompressedLength;
     image = make_unique<uInt8[]>(length);
     if(image == nullptr)
       throw runtime_error(errorMessage(ZipError::OUT_OF_MEMORY));
 
     try
     {
-      myZip->decompress(image, length);
+      zip.decompress(image, length);
       return length;
     }
     catch(const ZipError& err)
@@ -142,63 +124,42 @@ string ZipHandler::errorMessage(ZipError err)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-ZipHandler::ZipFilePtr ZipHandler::findCached(const string& filename)
+ZipHandler::ZipIndexPtr ZipHandler::readIndex(const string& filename)
 {
-  for(size_t cachenum = 0; cachenum < myZipCache.size(); ++cachenum)
-  {
-    // If we have a valid entry and it matches our filename,
-    // use it and remove from the cache
-    if(myZipCache[cachenum] && (filename == myZipCache[cachenum]->myFilename))
-    {
-      ZipFilePtr result;
-      std::swap(myZipCache[cachenum], result);
-      return result;
-    }
-  }
-  return ZipFilePtr();
-}
+  ZipFile zip(filename);
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void ZipHandler::addToCache()
-{
-  if(myZip == nullptr)
-    return;
+  // Open the file and read the central directory
+  if(!zip.open())
+    throw runtime_error(errorMessage(ZipError::FILE_ERROR));
+  zip.initialize();
 
-  // Close the open file
-  myZip->close();
+  ZipIndexPtr index = make_shared<ZipIndex>();
+  index->ecd = zip.myEcd;
 
-  // Find the first nullptr entry in the cache
-  size_t cachenum;
-  for(cachenum = 0; cachenum < myZipCache.size(); ++cachenum)
-    if(myZipCache[cachenum] == nullptr)
+  // Keep the headers of all non-empty files, and count ROM files
+  while(zip.myCdPos < zip.myEcd.cdSize)
+  {
+    const ZipHeader* header = zip.nextFile();
+    if(header == nullptr)
       break;
+    if(header->uncompressedLength == 0)
+      continue;
 
-  // If no room left in the cache, free the bottommost entry
-  if(cachenum == myZipCache.size())
-  {
-    cachenum--;
-    myZipCache[cachenum].reset();
+    index->headers.push_back(*header);
+    if(Bankswitch::isValidRomName(header->filename))
+      index->romfiles++;
   }
+  zip.close();
 
-  for( ; cachenum > 0; --cachenum)
-    myZipCache[cachenum] = std::move(myZipCache[cachenum - 1]);
-  myZipCache[0] = std::move(myZip);
-
-#if 0
-  cerr << "\nCACHE contents:\n";
-    for(cachenum = 0; cachenum < myZipCache.size(); ++cachenum)
-      if(myZipCache[cachenum] != nullptr)
-        cerr << "  " << cachenum << " : " << myZipCache[cachenum]->filename << endl;
-  cerr << endl;
-#endif
+  return index;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 ZipHandler::ZipFile::ZipFile(const string& filename)
   : myFilename(filename),
-    myBuffer(make_unique<uInt8[]>(DECOMPRESS_BUFSIZE))
+    myBuffer(make_unique<uInt8[]>(LocalFileHeaderReader::minimumLength()))
 {
-  std::fill(myBuffer.get(), myBuffer.get() + DECOMPRESS_BUFSIZE, 0);
+  std::fill(myBuffer.get(), myBuffer.get() + LocalFileHeaderReader::minimumLength(), 0);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -442,61 +403,46 @@ void ZipHandler::ZipFile::decompressDataType0(
 void ZipHandler::ZipFile::decompressDataType8(
     uInt64 offset, ByteBuffer& out, uInt64 length)
 {
-  uInt64 input_remaining = myHeader.compressedLength;
+  // Read all compressed data at once, plus a dummy byte at the end
+  // zlib counts the available bytes in 32 bits, so larger (zip64) data
+  // isn't supported
+  const uInt64 input_length = myHeader.compressedLength;
+  if(input_length + 1 > UINT32_MAX || length > UINT32_MAX)
+    throw runtime_error(errorMessage(ZipError::UNSUPPORTED));
+
+  ByteBuffer input = make_unique<uInt8[]>(input_length + 1);
+  if(input == nullptr)
+    throw runtime_error(errorMessage(ZipError::OUT_OF_MEMORY));
+  input[input_length] = 0;
+
+  uInt64 read_length = 0;
+  bool success = readStream(input, offset, input_length, read_length);
+  if(!success)
+    throw runtime_error(errorMessage(ZipError::FILE_ERROR));
+  else if(read_length != input_length)
+    throw runtime_error(errorMessage(ZipError::FILE_TRUNCATED));
 
   // Reset the stream
 	z_stream stream;
 	stream.zalloc = Z_NULL;
 	stream.zfree = Z_NULL;
 	stream.opaque = Z_NULL;
-	stream.avail_in = 0;
+	stream.next_in = input.get();
+	stream.avail_in = uInt32(input_length + 1);
 	stream.next_out = reinterpret_cast<Bytef *>(out.get());
-	stream.avail_out = uInt32(length); // TODO - use zip64
+	stream.avail_out = uInt32(length);
 
   // Initialize the decompressor
   int zerr = inflateInit2(&stream, -MAX_WBITS);
   if(zerr != Z_OK)
     throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
 
-  // Loop until we're done
-  for(;;)
+  // Now inflate everything in one go
+  zerr = inflate(&stream, Z_FINISH);
+  if(zerr != Z_STREAM_END)
   {
-    // Read in the next chunk of data
-    uInt64 read_length = 0;
-    bool success = readStream(myBuffer, offset,
-          std::min(input_remaining, uInt64(sizeof(myBuffer.get()))), read_length);
-    if(!success)
-    {
-      inflateEnd(&stream);
-      throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-    }
-    offset += read_length;
-
-    // If we read nothing, but still have data left, the file is truncated
-    if(read_length == 0 && input_remaining > 0)
-    {
-      inflateEnd(&stream);
-      throw runtime_error(errorMessage(ZipError::FILE_TRUNCATED));
-    }
-
-    // Fill out the input data
-    stream.next_in = myBuffer.get();
-    stream.avail_in = uInt32(read_length); // TODO - use zip64
-    input_remaining -= read_length;
-
-    // Add a dummy byte at end of compressed data
-    if(input_remaining == 0)
-      stream.avail_in++;
-
-    // Now inflate
-    zerr = inflate(&stream, Z_NO_FLUSH);
-    if(zerr == Z_STREAM_END)
-      break;
-    else if(zerr != Z_OK)
-    {
-      inflateEnd(&stream);
-      throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
-    }
+    inflateEnd(&stream);
+    throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
   }
 
   // Finish decompression
@@ -505,7 +451,7 @@ void ZipHandler::ZipFile::decompressDataType8(
     throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
 
   // If anything looks funny, report an error
-  if(stream.avail_out > 0 || input_remaining > 0)
+  if(stream.avail_out > 0)
     throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
 }
 
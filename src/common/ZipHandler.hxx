@@ -20,12 +20,19 @@
 #ifndef ZIP_HANDLER_HXX
 #define ZIP_HANDLER_HXX
 
+#include <unordered_map>
+
 #include "bspf.hxx"
 
 /**
   This class implements a thin wrapper around the zip file management code
   from the MAME project.
 
+  The central directory of each ZIP file is read only once per session and
+  kept in an index, until the modification time or length of the file
+  changes.  Listing the contents of a ZIP file therefore doesn't access the
+  file at all, and decompressing a file only has to read its data.
+
   @author  Original code by Aaron Giles, ZipHandler wrapper class and heavy
            modifications/refactoring by Stephen Anthony.
 */
@@ -48,7 +55,7 @@ class ZipHandler
     uInt64 decompress(ByteBuffer& image);
 
     // Answer the number of ROM files (with a valid extension) found
-    uInt16 romFiles() const { return myZip ? myZip->myRomfiles : 0; }
+    uInt16 romFiles() const { return myZip ? myZip->romfiles : 0; }
 
   private:
     // Error types
@@ -94,13 +101,23 @@ class ZipHandler
       uInt64 cdStartDiskOffset{0}; // offset of start of central directory with respect to the starting disk number
     };
 
+    // Contains the indexed central directory of a ZIP file
+    struct ZipIndex
+    {
+      uInt64 modified{0};         // modification time of the ZIP file
+      uInt64 length{0};           // length of the ZIP file
+      uInt16 romfiles{0};         // number of ROM files in central directory
+      ZipEcd ecd;                 // end of central directory
+      vector<ZipHeader> headers;  // headers of all non-empty files
+    };
+    using ZipIndexPtr = shared_ptr<ZipIndex>;
+
     // Describes an open ZIP file
     struct ZipFile
     {
-      string  myFilename;     // copy of ZIP filename (for caching)
+      string  myFilename;     // copy of ZIP filename
       fstream myStream;       // C++ fstream file handle
       uInt64  myLength{0};    // length of zip file
-      uInt16  myRomfiles{0};  // number of ROM files in central directory
 
       ZipEcd  myEcd;          // end of central directory
 
@@ -108,7 +125,7 @@ class ZipHandler
       uInt64    myCdPos{0};   // position in central directory
       ZipHeader myHeader;     // current file header
 
-      ByteBuffer myBuffer;    // buffer for decompression
+      ByteBuffer myBuffer;    // buffer for the local file header
 
       /** Constructor */
       explicit ZipFile(const string& filename);
@@ -143,7 +160,6 @@ class ZipHandler
       /** Decompress type 8 data (which is deflated) */
       void decompressDataType8(uInt64 offset, ByteBuffer& out, uInt64 length);
     };
-    using ZipFilePtr = unique_ptr<ZipFile>;
 
     /** Classes to parse the ZIP metadata in an abstracted way */
     class ReaderBase
@@ -290,18 +306,19 @@ class ZipHandler
     /** Get message for given ZipError enumeration */
     static string errorMessage(ZipError err);
 
-    /** Search cache for given ZIP file */
-    ZipFilePtr findCached(const string& filename);
-
-    /** Close a ZIP file and add it to the cache */
-    void addToCache();
+    /** Read the central directory of the given ZIP file into a new index */
+    static ZipIndexPtr readIndex(const string& filename);
 
   private:
-    static constexpr size_t DECOMPRESS_BUFSIZE = 16_KB;
-    static constexpr uInt32 CACHE_SIZE = 8; // number of open files to cache
+    // The indexed central directories of all ZIP files used in this session
+    std::unordered_map<string, ZipIndexPtr> myIndex;
+
+    // The currently open ZIP file
+    ZipIndexPtr myZip;
+    string myFilename;
 
-    ZipFilePtr myZip;
-    std::array<ZipFilePtr, CACHE_SIZE> myZipCache;
+    // The iterator position in the headers of the currently open ZIP file
+    size_t myPos{0};
 
   private:
     // Following constructors and assignment operators not supported
@@ -84,7 +84,31 @@ using BoolArray = std::vector<bool>;
 using ByteArray = std::vector<uInt8>;
 using ShortArray = std::vector<uInt16>;
 using StringList = std::vector<std::string>;
-using ByteBuffer = std::unique_ptr<uInt8[]>;  // NOLINT
+
+// Releases the memory of a ByteBuffer; this is normally allocated by new[]
+// (ie, make_unique), but it can also be borrowed from elsewhere (ie, the
+// RomCache), in which case the function to return it is passed along with
+// the size of the buffer
+class ByteBufferDeleter
+{
+  public:
+    using Release = void (*)(uInt8*, size_t);
+
+    ByteBufferDeleter() = default;
+    ByteBufferDeleter(std::default_delete<uInt8[]>) { }  // NOLINT: from make_unique
+    ByteBufferDeleter(Release release, size_t size)
+      : myRelease{release}, mySize{size} { }
+
+    void operator()(uInt8* buffer) const {
+      if(myRelease) myRelease(buffer, mySize);
+      else          delete[] buffer;
+    }
+
+  private:
+    Release myRelease{nullptr};
+    size_t mySize{0};
+};
+using ByteBuffer = std::unique_ptr<uInt8[], ByteBufferDeleter>;  // NOLINT
 using DWordBuffer = std::unique_ptr<uInt32[]>;  // NOLINT
 
 using AdjustFunction = std::function<void(int)>;
@@ -4,6 +4,7 @@ MODULE_OBJS := \
 	src/common/AudioQueue.o \
 	src/common/AudioSettings.o \
 	src/common/Base.o \
+	src/common/DirectoryScanner.o \
 	src/common/EventHandlerSDL2.o \
 	src/common/FBBackendSDL2.o \
 	src/common/FBSurfaceSDL2.o \
@@ -26,8 +27,10 @@ MODULE_OBJS := \
 	src/common/StaggeredLogger.o \
 	src/common/StateManager.o \
 	src/common/ThreadDebugging.o \
+	src/common/ThumbnailGenerator.o \
 	src/common/TimerManager.o \
 	src/common/VideoModeHandler.o \
+	src/common/VideoRecorder.o \
 	src/common/ZipHandler.o \
 	src/common/sdl_blitter/BilinearBlitter.o \
 	src/common/sdl_blitter/QisBlitter.o \
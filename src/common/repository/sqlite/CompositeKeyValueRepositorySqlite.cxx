@@ -41,41 +41,51 @@ shared_ptr<KeyValueRepository> CompositeKeyValueRepositorySqlite::get(const stri
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool CompositeKeyValueRepositorySqlite::has(const string& key)
+{
+  return !cached(key).empty();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CompositeKeyValueRepositorySqlite::remove(const string& key)
 {
   try {
-    (*myStmtCountSet)
+    (*myStmtDeleteSet)
       .reset()
-      .bind(1, key.c_str());
-
-    if (!myStmtCountSet->step())
-      throw SqliteError("count failed");
-
-    Int32 rowCount = myStmtCountSet->columnInt(0);
+      .bind(1, key.c_str())
+      .step();
 
-    myStmtCountSet->reset();
+    myStmtDeleteSet->reset();
 
-    return rowCount > 0;
-  } catch (const SqliteError& err) {
+    myCache[key].clear();
+  }
+  catch (const SqliteError& err) {
     Logger::error(err.what());
-
-    return false;
   }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void CompositeKeyValueRepositorySqlite::remove(const string& key)
+std::map<string, Variant>& CompositeKeyValueRepositorySqlite::cached(const string& key)
 {
+  auto it = myCache.find(key);
+  if (it != myCache.end()) return it->second;
+
+  std::map<string, Variant>& values = myCache[key];
+
   try {
-    (*myStmtDeleteSet)
+    (*myStmtSelect)
       .reset()
-      .bind(1, key.c_str())
-      .step();
+      .bind(1, key.c_str());
 
-    myStmtDelete->reset();
+    while (myStmtSelect->step())
+      values[myStmtSelect->columnText(0)] = myStmtSelect->columnText(1);
+
+    myStmtSelect->reset();
   }
   catch (const SqliteError& err) {
     Logger::error(err.what());
   }
+
+  return values;
 }
 
 
@@ -105,12 +115,6 @@ void CompositeKeyValueRepositorySqlite::initialize()
     myColKey1.c_str()
   );
 
-  myStmtCountSet = make_unique<SqliteStatement>(myDb,
-    "SELECT COUNT(*) FROM `%s` WHERE `%s` = ?",
-    myTableName.c_str(),
-    myColKey1.c_str()
-  );
-
   myStmtDelete = make_unique<SqliteStatement>(myDb,
     "DELETE FROM `%s` WHERE `%s` = ? AND `%s` = ?",
     myTableName.c_str(),
@@ -142,11 +146,68 @@ void CompositeKeyValueRepositorySqlite::initialize()
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 CompositeKeyValueRepositorySqlite::ProxyRepository::ProxyRepository(
-  const CompositeKeyValueRepositorySqlite& repo,
+  CompositeKeyValueRepositorySqlite& repo,
   const string& key
 ) : myRepo(repo), myKey(key)
 {}
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+std::map<string, Variant> CompositeKeyValueRepositorySqlite::ProxyRepository::load()
+{
+  return myRepo.cached(myKey);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool CompositeKeyValueRepositorySqlite::ProxyRepository::has(const string& key)
+{
+  const std::map<string, Variant>& values = myRepo.cached(myKey);
+
+  return values.find(key) != values.end();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool CompositeKeyValueRepositorySqlite::ProxyRepository::get(const string& key, Variant& value)
+{
+  const std::map<string, Variant>& values = myRepo.cached(myKey);
+
+  auto it = values.find(key);
+  if (it == values.end()) return false;
+
+  value = it->second;
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool CompositeKeyValueRepositorySqlite::ProxyRepository::save(const std::map<string, Variant>& values)
+{
+  if (!AbstractKeyValueRepositorySqlite::save(values)) return false;
+
+  std::map<string, Variant>& cachedValues = myRepo.cached(myKey);
+  for (const auto& pair: values)
+    cachedValues[pair.first] = pair.second;
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool CompositeKeyValueRepositorySqlite::ProxyRepository::save(const string& key, const Variant& value)
+{
+  if (!AbstractKeyValueRepositorySqlite::save(key, value)) return false;
+
+  myRepo.cached(myKey)[key] = value;
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CompositeKeyValueRepositorySqlite::ProxyRepository::remove(const string& key)
+{
+  AbstractKeyValueRepositorySqlite::remove(key);
+
+  myRepo.cached(myKey).erase(key);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 SqliteStatement& CompositeKeyValueRepositorySqlite::ProxyRepository::stmtInsert(
   const string& key, const string& value
@@ -18,6 +18,8 @@
 #ifndef COMPOSITE_KEY_VALUE_REPOSITORY_SQLITE_HXX
 #define COMPOSITE_KEY_VALUE_REPOSITORY_SQLITE_HXX
 
+#include <unordered_map>
+
 #include "repository/CompositeKeyValueRepository.hxx"
 
 #include "SqliteDatabase.hxx"
@@ -51,7 +53,19 @@ class CompositeKeyValueRepositorySqlite : public CompositeKeyValueRepositoryAtom
     class ProxyRepository : public AbstractKeyValueRepositorySqlite {
       public:
 
-        ProxyRepository(const CompositeKeyValueRepositorySqlite& repo, const string& key);
+        ProxyRepository(CompositeKeyValueRepositorySqlite& repo, const string& key);
+
+        std::map<string, Variant> load() override;
+
+        bool has(const string& key) override;
+
+        bool get(const string& key, Variant& value) override;
+
+        bool save(const std::map<string, Variant>& values) override;
+
+        bool save(const string& key, const Variant& value) override;
+
+        void remove(const string& key) override;
 
       protected:
 
@@ -64,7 +78,7 @@ class CompositeKeyValueRepositorySqlite : public CompositeKeyValueRepositoryAtom
 
       private:
 
-        const CompositeKeyValueRepositorySqlite& myRepo;
+        CompositeKeyValueRepositorySqlite& myRepo;
         const string myKey;
 
       private:
@@ -75,6 +89,14 @@ class CompositeKeyValueRepositorySqlite : public CompositeKeyValueRepositoryAtom
         ProxyRepository& operator=(ProxyRepository&&) = delete;
     };
 
+  private:
+
+    /**
+      Get all values stored for the given key; they are read from the
+      database on first use, and kept up to date afterwards.
+    */
+    std::map<string, Variant>& cached(const string& key);
+
   private:
 
     SqliteDatabase& myDb;
@@ -85,12 +107,14 @@ class CompositeKeyValueRepositorySqlite : public CompositeKeyValueRepositoryAtom
 
     unique_ptr<SqliteStatement> myStmtInsert;
     unique_ptr<SqliteStatement> myStmtSelect;
-    unique_ptr<SqliteStatement> myStmtCountSet;
     unique_ptr<SqliteStatement> myStmtDelete;
     unique_ptr<SqliteStatement> myStmtDeleteSet;
     unique_ptr<SqliteStatement> myStmtSelectOne;
     unique_ptr<SqliteStatement> myStmtCount;
 
+    // The values of all keys read so far (including keys without values)
+    std::unordered_map<string, std::map<string, Variant>> myCache;
+
    private:
 
     CompositeKeyValueRepositorySqlite(const CompositeKeyValueRepositorySqlite&) = delete;
@@ -70,6 +70,10 @@ void SqliteDatabase::initialize()
   }
 
   exec("PRAGMA journal_mode=WAL");
+  // With WAL, this only syncs at checkpoints instead of after each commit;
+  // the database stays consistent, but the last commits may be lost on a
+  // power failure
+  exec("PRAGMA synchronous=NORMAL");
 
   switch (sqlite3_wal_checkpoint_v2(myHandle, nullptr, SQLITE_CHECKPOINT_TRUNCATE, nullptr, nullptr)) {
     case SQLITE_OK:
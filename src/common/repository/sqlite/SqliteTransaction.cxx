@@ -22,7 +22,8 @@
 SqliteTransaction::SqliteTransaction(SqliteDatabase& db)
   : myDb{db}
 {
-  if (sqlite3_get_autocommit(db)) {
+  // Inside another transaction, the outer transaction commits
+  if (!sqlite3_get_autocommit(db)) {
     myTransactionClosed = true;
     return;
   }
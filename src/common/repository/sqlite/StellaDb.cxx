@@ -64,6 +64,14 @@ void StellaDb::initialize()
     highscoreRepository->initialize();
     myHighscoreRepository = std::move(highscoreRepository);
 
+    auto autodetectRepository = make_unique<CompositeKeyValueRepositorySqlite>(*myDb, "autodetection", "md5", "key", "value");
+    autodetectRepository->initialize();
+    myAutodetectRepository = std::move(autodetectRepository);
+
+    auto romIndexRepository = make_unique<KeyValueRepositorySqlite>(*myDb, "romindex", "path", "data");
+    romIndexRepository->initialize();
+    myRomIndexRepository = std::move(romIndexRepository);
+
     myPropertyRepository = make_unique<CompositeKVRJsonAdapter>(*myPropertyRepositoryHost);
 
     if (myDb->getUserVersion() == 0) {
@@ -78,6 +86,8 @@ void StellaDb::initialize()
     mySettingsRepository = make_unique<KeyValueRepositoryNoop>();
     myPropertyRepository = make_unique<CompositeKeyValueRepositoryNoop>();
     myHighscoreRepository = make_unique<CompositeKeyValueRepositoryNoop>();
+    myAutodetectRepository = make_unique<CompositeKeyValueRepositoryNoop>();
+    myRomIndexRepository = make_unique<KeyValueRepositoryNoop>();
 
     myDb.reset();
     myPropertyRepositoryHost.reset();
@@ -35,6 +35,8 @@ class StellaDb
     KeyValueRepositoryAtomic& settingsRepository() const { return *mySettingsRepository; }
     CompositeKeyValueRepository& propertyRepository() const { return *myPropertyRepository; }
     CompositeKeyValueRepositoryAtomic& highscoreRepository() const { return *myHighscoreRepository; }
+    CompositeKeyValueRepositoryAtomic& autodetectRepository() const { return *myAutodetectRepository; }
+    KeyValueRepositoryAtomic& romIndexRepository() const { return *myRomIndexRepository; }
 
     const string databaseFileName() const;
 
@@ -60,6 +62,8 @@ class StellaDb
     unique_ptr<KeyValueRepositoryAtomic> myPropertyRepositoryHost;
     unique_ptr<CompositeKeyValueRepository> myPropertyRepository;
     unique_ptr<CompositeKeyValueRepositoryAtomic> myHighscoreRepository;
+    unique_ptr<CompositeKeyValueRepositoryAtomic> myAutodetectRepository;
+    unique_ptr<KeyValueRepositoryAtomic> myRomIndexRepository;
 };
 
 #endif // STELLA_DB_HXX
@@ -79,7 +79,7 @@ void BilinearBlitter::free()
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void BilinearBlitter::blit(SDL_Surface& surface)
+void BilinearBlitter::blit(SDL_Surface& surface, const SDL_Rect& dirtyRect)
 {
   ASSERT_MAIN_THREAD;
 
@@ -88,7 +88,12 @@ void BilinearBlitter::blit(SDL_Surface& surface)
   SDL_Texture* texture = myTexture;
 
   if(myStaticData == nullptr) {
-    SDL_UpdateTexture(myTexture, &mySrcRect, surface.pixels, surface.pitch);
+    SDL_Rect rect;
+    if(textureUpdateRect(mySrcRect, dirtyRect, rect))
+      SDL_UpdateTexture(myTexture, &rect,
+        static_cast<uInt8*>(surface.pixels) + (rect.y - mySrcRect.y) * surface.pitch +
+          (rect.x - mySrcRect.x) * surface.format->BytesPerPixel,
+        surface.pitch);
     myTexture = mySecondaryTexture;
     mySecondaryTexture = texture;
   }
@@ -137,6 +142,7 @@ void BilinearBlitter::recreateTexturesIfNecessary()
     }
   }
 
+  invalidateTextures();
   myRecreateTextures = false;
   myTexturesAreAllocated = true;
 }
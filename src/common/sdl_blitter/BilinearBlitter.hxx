@@ -38,7 +38,7 @@ class BilinearBlitter : public Blitter {
       SDL_Surface* staticData = nullptr
     ) override;
 
-    virtual void blit(SDL_Surface& surface) override;
+    virtual void blit(SDL_Surface& surface, const SDL_Rect& dirtyRect) override;
 
   private:
     FBBackendSDL2& myFB;
@@ -35,14 +35,54 @@ class Blitter {
       SDL_Surface* staticData = nullptr
     ) = 0;
 
-    virtual void blit(SDL_Surface& surface) = 0;
+    /**
+      Render the surface.  Only the rows in 'dirtyRect' changed since the
+      last call, the rest of the surface doesn't need to be uploaded again.
+    */
+    virtual void blit(SDL_Surface& surface, const SDL_Rect& dirtyRect) = 0;
 
   protected:
 
     Blitter() = default;
 
+    /**
+      Streaming textures are double buffered, so the texture which is about
+      to be updated also misses the changes made to the other one.  This
+      calculates the area which has to be uploaded and remembers the current
+      changes for the next frame.
+
+      @return  False if the texture is up to date already
+    */
+    bool textureUpdateRect(const SDL_Rect& srcRect, const SDL_Rect& dirtyRect,
+                           SDL_Rect& updateRect)
+    {
+      SDL_Rect current;
+      if(!SDL_IntersectRect(&dirtyRect, &srcRect, &current))
+        current = SDL_Rect{0, 0, 0, 0};
+
+      if(myPendingFullUpdates > 0)
+      {
+        --myPendingFullUpdates;
+        updateRect = srcRect;
+      }
+      else
+        SDL_UnionRect(&current, &myPrevDirtyRect, &updateRect);
+
+      myPrevDirtyRect = current;
+
+      return !SDL_RectEmpty(&updateRect);
+    }
+
+    /**
+      Force full uploads to both textures, e.g. after they were recreated.
+    */
+    void invalidateTextures() { myPendingFullUpdates = 2; }
+
   private:
 
+    SDL_Rect myPrevDirtyRect{0, 0, 0, 0};
+    uInt32 myPendingFullUpdates{2};
+
     Blitter(const Blitter&) = delete;
 
     Blitter(Blitter&&) = delete;
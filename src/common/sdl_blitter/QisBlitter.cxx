@@ -88,7 +88,7 @@ void QisBlitter::free()
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void QisBlitter::blit(SDL_Surface& surface)
+void QisBlitter::blit(SDL_Surface& surface, const SDL_Rect& dirtyRect)
 {
   ASSERT_MAIN_THREAD;
 
@@ -97,9 +97,17 @@ void QisBlitter::blit(SDL_Surface& surface)
   SDL_Texture* intermediateTexture = myIntermediateTexture;
 
   if(myStaticData == nullptr) {
-    SDL_UpdateTexture(mySrcTexture, &mySrcRect, surface.pixels, surface.pitch);
-
-    blitToIntermediate();
+    // The intermediate textures are double buffered just like the source
+    // textures, so they don't need to be redrawn if nothing was uploaded
+    SDL_Rect rect;
+    if(textureUpdateRect(mySrcRect, dirtyRect, rect)) {
+      SDL_UpdateTexture(mySrcTexture, &rect,
+        static_cast<uInt8*>(surface.pixels) + (rect.y - mySrcRect.y) * surface.pitch +
+          (rect.x - mySrcRect.x) * surface.format->BytesPerPixel,
+        surface.pitch);
+
+      blitToIntermediate();
+    }
 
     myIntermediateTexture = mySecondaryIntermedateTexture;
     mySecondaryIntermedateTexture = intermediateTexture;
@@ -193,6 +201,7 @@ void QisBlitter::recreateTexturesIfNecessary()
     }
   }
 
+  invalidateTextures();
   myRecreateTextures = false;
   myTexturesAreAllocated = true;
 }
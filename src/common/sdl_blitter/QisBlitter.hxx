@@ -40,7 +40,7 @@ class QisBlitter : public Blitter {
       SDL_Surface* staticData = nullptr
     ) override;
 
-    virtual void blit(SDL_Surface& surface) override;
+    virtual void blit(SDL_Surface& surface, const SDL_Rect& dirtyRect) override;
 
   private:
 
@@ -314,15 +314,24 @@ bool CartDebug::disassemble(int bank, uInt16 PC, bool force)
       }
     }
 
-    // Always attempt to resolve code sections unless it's been
-    // specifically disabled
-    bool found = fillDisassemblyList(info, PC);
-    if(!found && DiStella::settings.resolveCode)
+    // Reuse the cached disassembly of the bank if nothing it depends on
+    // has changed since
+    const uInt16 base = (PC & 0x1000) ? offset : 0x80;
+    if(force || !restoreDisassembly(bank, disassemblyKey(info, base)))
     {
-      // Temporarily turn off code resolution
-      DiStella::settings.resolveCode = false;
-      fillDisassemblyList(info, PC);
-      DiStella::settings.resolveCode = true;
+      // Always attempt to resolve code sections unless it's been
+      // specifically disabled
+      bool found = fillDisassemblyList(info, PC);
+      if(!found && DiStella::settings.resolveCode)
+      {
+        // Temporarily turn off code resolution
+        DiStella::settings.resolveCode = false;
+        fillDisassemblyList(info, PC);
+        DiStella::settings.resolveCode = true;
+      }
+      // Distella marks tentative code in the access flags, so the key must
+      // be determined afterwards
+      storeDisassembly(bank, disassemblyKey(info, base));
     }
   }
 
@@ -365,6 +374,86 @@ bool CartDebug::fillDisassemblyList(BankInfo& info, uInt16 search)
   return found;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 CartDebug::disassemblyKey(const BankInfo& info, uInt16 base) const
+{
+  // FNV-1a
+  uInt64 key = 0xcbf29ce484222325ULL;
+  const auto hash = [&key](uInt32 value) {
+    key = (key ^ value) * 0x100000001b3ULL;
+  };
+
+  hash(base);
+  for(uInt32 addr = base; addr < base + info.size; ++addr)
+  {
+    hash(myDebugger.peek(addr));
+    hash(myDebugger.getAccessFlags(addr));
+  }
+  // The list sizes separate the lists, so their elements can't be confused
+  hash(uInt32(info.addressList.size()));
+  for(const auto& addr: info.addressList)
+    hash(addr);
+  hash(uInt32(info.directiveList.size()));
+  for(const auto& tag: info.directiveList)
+  {
+    hash(uInt32(tag.type));
+    hash(tag.start);
+    hash(tag.end);
+  }
+
+  const DiStella::Settings& settings = DiStella::settings;
+  hash(uInt32(settings.gfxFormat));
+  hash(settings.resolveCode | settings.showAddresses << 1 | settings.aFlag << 2 |
+       settings.fFlag << 3 | settings.rFlag << 4 | settings.bFlag << 5);
+  hash(uInt32(settings.bytesWidth));
+  hash(myLabelGeneration);
+  hash(myLabelLength);
+
+  return key;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool CartDebug::restoreDisassembly(int bank, uInt64 key)
+{
+  const auto& iter = myDisassemblyCache.find(bank);
+  if(iter == myDisassemblyCache.end() || iter->second.key != key)
+    return false;
+
+  CachedDisassembly& cached = iter->second;
+
+  cached.lastUse = ++myDisassemblyCacheUse;
+  myDisassembly = cached.disassembly;
+  myAddrToLineList = cached.addrToLineList;
+  myAddrToLineIsROM = cached.addrToLineIsROM;
+  myDisLabels = cached.disLabels;
+  myDisDirectives = cached.disDirectives;
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartDebug::storeDisassembly(int bank, uInt64 key)
+{
+  // Make room by dropping the least recently used disassembly
+  if(myDisassemblyCache.size() >= MAX_CACHED_DISASSEMBLIES &&
+     myDisassemblyCache.find(bank) == myDisassemblyCache.end())
+    myDisassemblyCache.erase(std::min_element(
+      myDisassemblyCache.begin(), myDisassemblyCache.end(),
+      [](const auto& a, const auto& b) {
+        return a.second.lastUse < b.second.lastUse;
+      }));
+
+  CachedDisassembly& cached = myDisassemblyCache[bank];
+
+  cached.key = key;
+  cached.lastUse = ++myDisassemblyCacheUse;
+  cached.disassembly = myDisassembly;
+  cached.addrToLineList = myAddrToLineList;
+  cached.addrToLineIsROM = myAddrToLineIsROM;
+  cached.disLabels = myDisLabels;
+  cached.disDirectives = myDisDirectives;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int CartDebug::addressToLine(uInt16 address) const
 {
@@ -583,6 +672,7 @@ bool CartDebug::addLabel(const string& label, uInt16 address)
       myUserLabels.emplace(address, label);
       myLabelLength = std::max(myLabelLength, uInt16(label.size()));
       mySystem.setDirtyPage(address);
+      ++myLabelGeneration;
       return true;
   }
 }
@@ -602,6 +692,7 @@ bool CartDebug::removeLabel(const string& label)
     // Erase the label itself
     mySystem.setDirtyPage(iter->second);
     myUserAddresses.erase(iter);
+    ++myLabelGeneration;
 
     return true;
   }
@@ -831,6 +922,7 @@ string CartDebug::loadSymbolFile()
 
   myUserAddresses.clear();
   myUserLabels.clear();
+  ++myLabelGeneration;
 
   stringstream in;
   try
@@ -322,6 +322,18 @@ class CartDebug : public DebuggerSystem
     // Return whether the search address was actually in the list
     bool fillDisassemblyList(BankInfo& bankinfo, uInt16 search);
 
+    // Determine a hash over everything the disassembly of a bank depends on;
+    // its contents and access flags at 'base', its addresses and directives,
+    // the labels and the Distella settings
+    uInt64 disassemblyKey(const BankInfo& info, uInt16 base) const;
+
+    // Restore the disassembly of a bank from the cache, if the key matches
+    // Return whether a matching disassembly was found
+    bool restoreDisassembly(int bank, uInt64 key);
+
+    // Store the current disassembly of a bank in the cache
+    void storeDisassembly(int bank, uInt64 key);
+
     // Analyze of bank of ROM, generating a list of Distella directives
     // based on its disassembly
     void getBankDirectives(ostream& buf, const BankInfo& info) const;
@@ -350,6 +362,23 @@ class CartDebug : public DebuggerSystem
     std::map<uInt16, int> myAddrToLineList;
     bool myAddrToLineIsROM{true};
 
+    // The most recently used disassemblies, so switching between banks
+    // doesn't require running Distella again
+    struct CachedDisassembly {
+      uInt64 key{0};
+      uInt64 lastUse{0};
+      Disassembly disassembly;
+      std::map<uInt16, int> addrToLineList;
+      bool addrToLineIsROM{true};
+      AddrTypeArray disLabels, disDirectives;
+    };
+    std::map<int, CachedDisassembly> myDisassemblyCache;
+    uInt64 myDisassemblyCacheUse{0};
+    static constexpr size_t MAX_CACHED_DISASSEMBLIES = 16;
+
+    // Changed whenever a user label changes, which invalidates the cache
+    uInt32 myLabelGeneration{0};
+
     // Mappings from label to address (and vice versa) for items
     // defined by the user (either through a DASM symbol file or manually
     // from the commandline in the debugger)
@@ -0,0 +1,60 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "CycleProfiler.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CycleProfiler::reset()
+{
+  myBanks.clear();
+  myTotalCycles = 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const CycleProfiler::Entry* CycleProfiler::get(uInt16 addr, uInt16 bank) const
+{
+  if(bank >= myBanks.size() || myBanks[bank].empty())
+    return nullptr;
+
+  const Entry& entry = myBanks[bank][addr & ADDRESS_MASK];
+
+  return entry.cycles ? &entry : nullptr;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+CycleProfiler::HotSpotList CycleProfiler::hotSpots(size_t count) const
+{
+  HotSpotList list;
+
+  for(size_t bank = 0; bank < myBanks.size(); ++bank)
+    for(size_t addr = 0; addr < myBanks[bank].size(); ++addr)
+      if(myBanks[bank][addr].cycles)
+        list.push_back({uInt16(addr), uInt16(bank), myBanks[bank][addr]});
+
+  const auto compare = [](const HotSpot& a, const HotSpot& b) {
+    return a.entry.cycles > b.entry.cycles;
+  };
+  if(count < list.size())
+  {
+    std::partial_sort(list.begin(), list.begin() + count, list.end(), compare);
+    list.resize(count);
+  }
+  else
+    std::sort(list.begin(), list.end(), compare);
+
+  return list;
+}
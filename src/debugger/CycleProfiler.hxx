@@ -0,0 +1,111 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef CYCLE_PROFILER_HXX
+#define CYCLE_PROFILER_HXX
+
+#include "bspf.hxx"
+
+/**
+  This class accumulates the CPU cycles spent at each (bank, address) of
+  the cartridge, including the cycles the CPU is halted by a WSYNC.  It is
+  owned by the M6502 and fed while profiling is enabled.
+*/
+class CycleProfiler
+{
+  private:
+    static constexpr uInt16 ADDRESS_MASK = 0x1fff;
+
+  public:
+    struct Entry
+    {
+      uInt64 cycles{0};       // cycles of the instruction(s), incl. haltCycles
+      uInt64 haltCycles{0};   // cycles halted by WSYNC after the instruction
+      uInt32 count{0};        // number of times the instruction was executed
+    };
+
+    struct HotSpot
+    {
+      uInt16 addr{0};
+      uInt16 bank{0};
+      Entry entry;
+    };
+    using HotSpotList = std::vector<HotSpot>;
+
+    CycleProfiler() = default;
+
+    bool isEnabled() const { return myEnabled; }
+
+    /** Enable or disable collecting data; the collected data is kept */
+    void enable(bool enable) { myEnabled = enable; }
+
+    /** Clear all collected data */
+    void reset();
+
+    /** Add the cycles of an instruction executed at the given address */
+    void add(uInt16 addr, uInt16 bank, uInt32 cycles) {
+      Entry& entry = getEntry(addr, bank);
+
+      entry.cycles += cycles;
+      ++entry.count;
+      myTotalCycles += cycles;
+    }
+
+    /** Add the cycles the CPU was halted by the instruction at the given address */
+    void addHalt(uInt16 addr, uInt16 bank, uInt32 cycles) {
+      Entry& entry = getEntry(addr, bank);
+
+      entry.cycles += cycles;
+      entry.haltCycles += cycles;
+      myTotalCycles += cycles;
+    }
+
+    /** Get the data collected for the given address, or nullptr if none */
+    const Entry* get(uInt16 addr, uInt16 bank) const;
+
+    /** Total number of cycles collected */
+    uInt64 totalCycles() const { return myTotalCycles; }
+
+    /** Returns the addresses which used the most cycles, sorted descending */
+    HotSpotList hotSpots(size_t count) const;
+
+  private:
+    Entry& getEntry(uInt16 addr, uInt16 bank) {
+      if(bank >= myBanks.size())
+        myBanks.resize(bank + 1);
+      if(myBanks[bank].empty())
+        myBanks[bank].resize(ADDRESS_MASK + 1);
+
+      return myBanks[bank][addr & ADDRESS_MASK];
+    }
+
+  private:
+    // Per bank one entry for each address, only allocated when used
+    std::vector<std::vector<Entry>> myBanks;
+
+    uInt64 myTotalCycles{0};
+    bool myEnabled{false};
+
+  private:
+    // Following constructors and assignment operators not supported
+    CycleProfiler(const CycleProfiler&) = delete;
+    CycleProfiler(CycleProfiler&&) = delete;
+    CycleProfiler& operator=(const CycleProfiler&) = delete;
+    CycleProfiler& operator=(CycleProfiler&&) = delete;
+};
+
+#endif
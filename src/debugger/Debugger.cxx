@@ -194,6 +194,12 @@ BreakpointMap& Debugger::breakPoints() const
   return mySystem.m6502().breakPoints();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+CycleProfiler& Debugger::cycleProfiler() const
+{
+  return mySystem.m6502().cycleProfiler();
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 TrapArray& Debugger::readTraps() const
 {
@@ -28,6 +28,7 @@ class EditTextWidget;
 class RomWidget;
 class Expression;
 class BreakpointMap;
+class CycleProfiler;
 class TrapArray;
 class PromptWidget;
 class ButtonWidget;
@@ -153,6 +154,7 @@ class Debugger : public DialogContainer
     TiaOutputWidget& tiaOutput() const  { return myDialog->tiaOutput(); }
 
     BreakpointMap& breakPoints() const;
+    CycleProfiler& cycleProfiler() const;
 
     TrapArray& readTraps() const;
     TrapArray& writeTraps() const;
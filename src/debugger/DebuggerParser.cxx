@@ -1709,6 +1709,65 @@ void DebuggerParser::executePrint()
   commandResult << eval();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// "profile"
+void DebuggerParser::executeProfile()
+{
+  CycleProfiler& profiler = debugger.cycleProfiler();
+
+  if(argCount == 1 && (argStrings[0] == "on" || argStrings[0] == "off"))
+  {
+    profiler.enable(argStrings[0] == "on");
+    commandResult << "profiling " << (profiler.isEnabled() ? "enabled" : "disabled");
+    return;
+  }
+  if(argCount == 1 && argStrings[0] == "reset")
+  {
+    profiler.reset();
+    commandResult << "profile data cleared";
+    return;
+  }
+  if(argCount == 1 && args[0] <= 0)
+  {
+    commandResult << red("invalid argument (must be on, off, reset or a count)");
+    return;
+  }
+
+  const size_t count = argCount == 1 ? size_t(args[0]) : 20;
+  const uInt64 total = profiler.totalCycles();
+
+  if(total == 0)
+  {
+    commandResult << (profiler.isEnabled() ? "no profile data yet"
+                      : "no profile data, enable with 'profile on'");
+    return;
+  }
+
+  const uInt32 romBankCount = debugger.cartDebug().romBankCount();
+
+  commandResult << "total cycles: " << total << endl
+                << (romBankCount > 1 ? "bank " : "")
+                << "address  label                 cycles      wsync      count       %";
+  for(const auto& hotSpot : profiler.hotSpots(count))
+  {
+    const CycleProfiler::Entry& entry = hotSpot.entry;
+
+    commandResult << endl;
+    if(romBankCount > 1)
+      commandResult << "#" << std::setfill(' ') << std::left << std::dec
+                    << std::setw(4) << hotSpot.bank;
+    commandResult << "$" << Base::HEX4 << hotSpot.addr << "    " << std::setfill(' ')
+                  << std::left << std::setw(16)
+                  << debugger.cartDebug().getLabel(hotSpot.addr, true).substr(0, 16)
+                  << std::right << std::dec
+                  << std::setw(12) << entry.cycles
+                  << std::setw(11) << entry.haltCycles
+                  << std::setw(11) << entry.count
+                  << std::setw(8) << std::fixed << std::setprecision(2)
+                  << entry.cycles * 100.0 / total;
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // "ram"
 void DebuggerParser::executeRam()
@@ -1941,6 +2000,31 @@ void DebuggerParser::executeSaveconfig()
   commandResult << debugger.cartDebug().saveConfigFile();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// "savecycles"
+void DebuggerParser::executeSavecycles()
+{
+  const string path = debugger.myOSystem.userDir().getPath() + cartName() + "_wsync.csv";
+
+  if(argCount && argStrings[0] == "?")
+  {
+    DebuggerDialog* dlg = debugger.myDialog;
+
+    BrowserDialog::show(dlg, "Save WSYNC Cycles as", path,
+                        BrowserDialog::Mode::FileSave,
+                        [this, dlg](bool OK, const FilesystemNode& node)
+    {
+      if(OK)
+        dlg->prompt().print(debugger.tiaDebug().saveWsyncCyclesFile(node.getPath()) + '\n');
+      dlg->prompt().printPrompt();
+    });
+    // avoid printing a new prompt
+    commandResult.str("_NO_PROMPT");
+  }
+  else
+    commandResult << debugger.tiaDebug().saveWsyncCyclesFile(path);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // "savedis"
 void DebuggerParser::executeSavedisassembly()
@@ -2475,7 +2559,7 @@ void DebuggerParser::executeZ()
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // List of all commands available to the parser
-std::array<DebuggerParser::Command, 100> DebuggerParser::commands = { {
+std::array<DebuggerParser::Command, 102> DebuggerParser::commands = { {
   {
     "a",
     "Set Accumulator to <value>",
@@ -3086,6 +3170,17 @@ std::array<DebuggerParser::Command, 100> DebuggerParser::commands = { {
     std::mem_fn(&DebuggerParser::executePrint)
   },
 
+  {
+    "profile",
+    "Profile CPU cycles per instruction, or list the xx hottest",
+    "Cycles include WSYNC halts, sorted report without arguments\n"
+    "Example: profile on, profile off, profile reset, profile #20",
+    false,
+    true,
+    { Parameters::ARG_LABEL, Parameters::ARG_END_ARGS },
+    std::mem_fn(&DebuggerParser::executeProfile)
+  },
+
   {
     "ram",
     "Show ZP RAM, or set address xx to yy1 [yy2 ...]",
@@ -3220,6 +3315,17 @@ std::array<DebuggerParser::Command, 100> DebuggerParser::commands = { {
     std::mem_fn(&DebuggerParser::executeSaveconfig)
   },
 
+  {
+    "savecycles",
+    "Save CPU cycles before WSYNC per scanline to CSV file [?]",
+    "Example: savecycles, savecycles ?\n"
+    "NOTE: saves the last frame to user dir by default",
+    false,
+    false,
+    { Parameters::ARG_LABEL, Parameters::ARG_END_ARGS },
+    std::mem_fn(&DebuggerParser::executeSavecycles)
+  },
+
   {
     "savedis",
     "Save Distella disassembly to file [?]",
@@ -101,7 +101,7 @@ class DebuggerParser
       std::array<Parameters, 10> parms;
       std::function<void (DebuggerParser*)> executor;
     };
-    static std::array<Command, 100> commands;
+    static std::array<Command, 102> commands;
 
     struct Trap
     {
@@ -207,6 +207,7 @@ class DebuggerParser
     void executePCol();
     void executePGfx();
     void executePrint();
+    void executeProfile();
     void executeRam();
     void executeReset();
     void executeRewind();
@@ -221,6 +222,7 @@ class DebuggerParser
     void executeSaveAccess();
     void executeSaveallstates();
     void executeSaveconfig();
+    void executeSavecycles();
     void executeSavedisassembly();
     void executeSaverom();
     void executeSaveses();
@@ -20,6 +20,8 @@
 #include "Debugger.hxx"
 #include "TIA.hxx"
 #include "DelayQueueIterator.hxx"
+#include "DebuggerParser.hxx"
+#include "FSNode.hxx"
 
 #include "TIADebug.hxx"
 
@@ -917,6 +919,44 @@ int TIADebug::frameWsyncCycles() const
   return myTIA.frameWSyncCycles();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string TIADebug::saveWsyncCyclesFile(string path) const
+{
+  // CPU cycles used before WSYNC on each scanline of the previous frame;
+  // both columns stay empty for scanlines without WSYNC
+  const auto& lineCycles = myTIA.lastFrameWsyncCycles();
+  const uInt32 lines = std::min(myTIA.scanlinesLastFrame(), TIA::MAX_WSYNC_LINES);
+  stringstream out;
+
+  out << "Scanline,Cycles before WSYNC,Cycles left" << endl;
+  for(uInt32 line = 0; line < lines; ++line)
+  {
+    out << line << ",";
+    if(lineCycles[line] != TIA::NO_WSYNC)
+      out << int(lineCycles[line]) << ","
+          << int(TIAConstants::H_CYCLES) - lineCycles[line];
+    else
+      out << ",";
+    out << endl;
+  }
+
+  try
+  {
+    // Append default extension when missing
+    if(path.find_last_of('.') == string::npos)
+      path += ".csv";
+
+    FilesystemNode node(path);
+
+    node.write(out);
+    return "saved WSYNC cycles as " + node.getShortPath();
+  }
+  catch(...)
+  {
+  }
+  return DebuggerParser::red("failed to save WSYNC cycles file");
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int TIADebug::cyclesLo() const
 {
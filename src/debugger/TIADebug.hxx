@@ -170,6 +170,7 @@ class TIADebug : public DebuggerSystem
     int frameCount() const;
     int frameCycles() const;
     int frameWsyncCycles() const;
+    string saveWsyncCyclesFile(string path) const;
     int cyclesLo() const;
     int cyclesHi() const;
     int clocksThisLine() const;
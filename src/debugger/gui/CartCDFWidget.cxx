@@ -18,6 +18,8 @@
 #include "DataGridWidget.hxx"
 #include "PopUpWidget.hxx"
 #include "EditTextWidget.hxx"
+#include "StringListWidget.hxx"
+#include "OSystem.hxx"
 #include "CartCDFWidget.hxx"
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -227,6 +229,21 @@ CartridgeCDFWidget::CartridgeCDFWidget(
                                     EditTextWidget::calcWidth(_font, 6), myLineHeight, "");
   myThumbWrites->setEditable(false);
   myThumbWrites->setToolTip("Number of write of last ARM run.");
+
+  xpos = HBORDER;  ypos += myLineHeight + VGAP * 2;
+  myArmProfile = new CheckboxWidget(boss, _font, xpos, ypos + 1, "Profile ARM code",
+                                    kProfileChanged);
+  myArmProfile->setTarget(this);
+  myArmProfile->setToolTip("Count ARM instructions and memory cycles per function.\n"
+                           "Symbols are loaded from a .elf or .map file named like the ROM.");
+
+  xpos = HBORDER + INDENT;  ypos += myLineHeight + VGAP;
+  myArmHotSpots = new StringListWidget(boss, _nfont, xpos, ypos,
+                                       w - xpos - HBORDER - 16, myLineHeight * 6,
+                                       false);
+  myArmHotSpots->setEditable(false);
+  myArmHotSpots->setToolTip("Cycles %, memory cycles, instructions, address and\n"
+                            "function of the ARM hot spots since profiling started.");
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -415,6 +432,19 @@ void CartridgeCDFWidget::loadConfig()
   myThumbWrites->setText(Common::Base::toString(myCart.stats().writes,
                          Common::Base::Fmt::_10_6));
 
+  const ThumbulatorProfiler* profiler = myCart.thumbulator()->profiler();
+  StringList hotSpots;
+
+  myArmProfile->setState(profiler != nullptr);
+  if(profiler)
+  {
+    const uInt64 total = profiler->totalCycles();
+
+    for(const auto& spot: profiler->hotSpots(50))
+      hotSpots.push_back(ThumbulatorProfiler::toString(spot, total));
+  }
+  myArmHotSpots->setList(hotSpots);
+
   CartDebugWidget::loadConfig();
 }
 
@@ -429,6 +459,12 @@ void CartridgeCDFWidget::handleCommand(CommandSender* sender,
     myCart.lockBank();
     invalidate();
   }
+  else if(cmd == kProfileChanged)
+  {
+    myCart.thumbulator()->enableProfiling(myArmProfile->getState());
+    if(myCart.thumbulator()->profiler())
+      myCart.thumbulator()->profiler()->loadSymbolsFor(instance().romFile());
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
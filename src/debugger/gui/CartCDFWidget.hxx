@@ -23,6 +23,7 @@ class CheckboxWidget;
 class DataGridWidget;
 class StaticTextWidget;
 class EditTextWidget;
+class StringListWidget;
 
 #include "CartCDF.hxx"
 #include "CartDebugWidget.hxx"
@@ -74,10 +75,15 @@ class CartridgeCDFWidget : public CartDebugWidget
     EditTextWidget* myThumbFetches{nullptr};
     EditTextWidget* myThumbReads{nullptr};
     EditTextWidget* myThumbWrites{nullptr};
+    CheckboxWidget* myArmProfile{nullptr};
+    StringListWidget* myArmHotSpots{nullptr};
 
     CartState myOldState;
 
-    enum { kBankChanged = 'bkCH' };
+    enum {
+      kBankChanged    = 'bkCH',
+      kProfileChanged = 'prCH'
+    };
 
   private:
     bool isCDFJ() const;
@@ -18,6 +18,7 @@
 #include "bspf.hxx"
 #include "OSystem.hxx"
 #include "Debugger.hxx"
+#include "CycleProfiler.hxx"
 #include "DiStella.hxx"
 #include "Widget.hxx"
 #include "Dialog.hxx"
@@ -543,6 +544,10 @@ void RomListWidget::drawWidget(bool hilite)
   if(actualWidth < codeDisasmW)
     codeDisasmW = actualWidth;
 
+  // When profiling, the cycle column shows each instruction's share of all cycles
+  const CycleProfiler& profiler = instance().debugger().cycleProfiler();
+  const bool showProfile = profiler.isEnabled() && profiler.totalCycles() > 0;
+
   xpos = _x + CheckboxWidget::boxSize(_font) + 10;  ypos = _y + 2;
   for(i = 0, pos = _currentPos; i < _rows && pos < len; i++, pos++, ypos += _lineHeight)
   {
@@ -591,9 +596,24 @@ void RomListWidget::drawWidget(bool hilite)
         if(dlist[pos].disasm.length() > 8)
           s.drawString(_font, dlist[pos].disasm.substr(8), xpos + _labelWidth + 7 * _fontWidth, ypos,
                         codeDisasmW - 7 * _fontWidth, textColor);
-        // Draw cycle count
-        s.drawString(_font, dlist[pos].ccount, xpos + _labelWidth + codeDisasmW, ypos,
-                      cycleCountW, textColor);
+        // Draw cycle count, or the profiled share of cycles
+        const CycleProfiler::Entry* entry = showProfile
+          ? profiler.get(dlist[pos].address,
+                         instance().debugger().cartDebug().getBank(dlist[pos].address))
+          : nullptr;
+
+        if(entry)
+        {
+          const double percent = entry->cycles * 100.0 / profiler.totalCycles();
+          ostringstream buf;
+
+          buf << std::fixed << std::setprecision(percent < 10 ? 2 : 1) << percent << "%";
+          s.drawString(_font, buf.str(), xpos + _labelWidth + codeDisasmW, ypos,
+                       cycleCountW, percent >= HOT_PERCENT ? kDbgColorRed : textColor);
+        }
+        else
+          s.drawString(_font, dlist[pos].ccount, xpos + _labelWidth + codeDisasmW, ypos,
+                        cycleCountW, textColor);
       }
       else
       {
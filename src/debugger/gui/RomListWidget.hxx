@@ -91,6 +91,10 @@ class RomListWidget : public EditableWidget
     Common::Point getToolTipIndex(const Common::Point& pos) const;
 
   private:
+    // Instructions using at least this share (in %) of all profiled cycles
+    // are highlighted
+    static constexpr double HOT_PERCENT = 5.0;
+
     unique_ptr<RomListSettings> myMenu;
     ScrollBarWidget* myScrollBar{nullptr};
 
@@ -47,6 +47,8 @@ TiaOutputWidget::TiaOutputWidget(GuiObject* boss, const GUI::Font& font,
   VarList::push_back(l, "Fill to scanline", "scanline");
   VarList::push_back(l, "Toggle breakpoint", "bp");
   VarList::push_back(l, "Set zoom position", "zoom");
+  VarList::push_back(l, "Toggle WSYNC heatmap", "heatmap");
+  VarList::push_back(l, "Save WSYNC cycles", "cycles");
 #ifdef PNG_SUPPORT
   VarList::push_back(l, "Save snapshot", "snap");
 #endif
@@ -153,6 +155,16 @@ void TiaOutputWidget::handleCommand(CommandSender* sender, int cmd, int data, in
       if(myZoom)
         myZoom->setPos(myClickX, myClickY);
     }
+    else if(rmb == "heatmap")
+    {
+      myShowHeatmap = !myShowHeatmap;
+      setDirty();
+    }
+    else if(rmb == "cycles")
+    {
+      string message = instance().debugger().parser().run("savecycles");
+      instance().frameBuffer().showTextMessage(message);
+    }
     else if(rmb == "snap")
     {
       instance().debugger().parser().run("savesnap");
@@ -195,6 +207,16 @@ string TiaOutputWidget::getToolTip(const Common::Point& pos) const
     << "X: #" << idx.x
     << "\nY: #" << idx.y + startLine
     << "\nC: $" << Common::Base::toString(tiaOutputBuffer[i], Common::Base::Fmt::_16);
+  if(myShowHeatmap)
+  {
+    const uInt8 cycles = instance().console().tia().scanlineWsyncCycles(startLine + yStart + idx.y);
+
+    buf << "\nWSYNC: ";
+    if(cycles != TIA::NO_WSYNC)
+      buf << "#" << int(cycles);
+    else
+      buf << "none";
+  }
 
   return buf.str();
 }
@@ -228,6 +250,8 @@ void TiaOutputWidget::drawWidget(bool hilite)
   scanoffset = width * scany + scanx;
   uInt8* tiaOutputBuffer = instance().console().tia().outputBuffer();
   const TIASurface& tiaSurface = instance().frameBuffer().tiaSurface();
+  const TIA& tia = instance().console().tia();
+  const uInt32 startLine = tia.startLine();
 
   for(uInt32 y = 0, i = yStart * width; y < height; ++y)
   {
@@ -239,6 +263,25 @@ void TiaOutputWidget::drawWidget(bool hilite)
       *line_ptr++ = pixel;
       *line_ptr++ = pixel;
     }
+    if(myShowHeatmap)
+    {
+      // Overlay a bar for the CPU cycles used before WSYNC, colored from
+      // green (idle) via yellow to red (76 cycle budget used up)
+      const uInt32 cycles = tia.scanlineWsyncCycles(startLine + yStart + y);
+
+      if(cycles != TIA::NO_WSYNC)
+      {
+        const uInt32 heat = std::min(cycles, uInt32(TIAConstants::H_CYCLES)) * 510
+          / TIAConstants::H_CYCLES;
+        const uInt32 color = instance().frameBuffer().mapRGB(
+          uInt8(std::min(heat, 255U)), uInt8(std::min(510 - heat, 255U)), 0);
+        const uInt32 len = std::max(heat * (width << 1) / 510, 1U);
+
+        // Only every other pixel, so the frame remains visible
+        for(uInt32 x = 0; x < len; x += 2)
+          myLineBuffer[x] = color;
+      }
+    }
     s.drawPixels(myLineBuffer.data(), _x + 1, _y + 1 + y, width << 1);
   }
 
@@ -60,6 +60,9 @@ class TiaOutputWidget : public Widget, public CommandSender
 
     int myClickX{0}, myClickY{0};
 
+    // Show the CPU cycles used before WSYNC per scanline
+    bool myShowHeatmap{false};
+
     // Create this buffer once, instead of allocating it each time the
     // TIA image is redrawn
     std::array<uInt32, 320> myLineBuffer;
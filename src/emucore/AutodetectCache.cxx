@@ -0,0 +1,142 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "Version.hxx"
+#include "repository/CompositeKeyValueRepositoryNoop.hxx"
+#include "AutodetectCache.hxx"
+
+namespace {
+  constexpr char KEY_VERSION[] = "version";
+  constexpr char KEY_BANKSWITCH[] = "bankswitch";
+  constexpr char KEY_CONTROLLER_LEFT[] = "controller_left";
+  constexpr char KEY_CONTROLLER_RIGHT[] = "controller_right";
+  constexpr char KEY_FORMAT[] = "format";
+  constexpr char KEY_FORMAT_BANKSWITCH[] = "format_bankswitch";
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+AutodetectCache::AutodetectCache()
+  : myRepository{make_shared<CompositeKeyValueRepositoryNoop>()}
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AutodetectCache::setRepository(
+    shared_ptr<CompositeKeyValueRepositoryAtomic> repository)
+{
+  myRepository = repository;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool AutodetectCache::getBankswitch(const string& md5, Bankswitch::Type& type) const
+{
+  string name;
+  if(!get(md5, KEY_BANKSWITCH, name))
+    return false;
+
+  const Bankswitch::Type cached = Bankswitch::nameToType(name);
+  if(cached == Bankswitch::Type::_AUTO)
+    return false;
+
+  type = cached;
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AutodetectCache::setBankswitch(const string& md5, Bankswitch::Type type)
+{
+  set(md5, KEY_BANKSWITCH, Bankswitch::typeToName(type));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool AutodetectCache::getController(const string& md5, Controller::Jack port,
+                                    Controller::Type& type) const
+{
+  string name;
+  if(!get(md5, port == Controller::Jack::Left
+      ? KEY_CONTROLLER_LEFT : KEY_CONTROLLER_RIGHT, name))
+    return false;
+
+  const Controller::Type cached = Controller::getType(name);
+  if(cached == Controller::Type::Unknown)
+    return false;
+
+  type = cached;
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AutodetectCache::setController(const string& md5, Controller::Jack port,
+                                    Controller::Type type)
+{
+  set(md5, port == Controller::Jack::Left
+      ? KEY_CONTROLLER_LEFT : KEY_CONTROLLER_RIGHT, Controller::getPropName(type));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool AutodetectCache::getDisplayFormat(const string& md5, const string& bsType,
+                                       string& format) const
+{
+  string cachedType, cached;
+  if(!get(md5, KEY_FORMAT_BANKSWITCH, cachedType) || cachedType != bsType ||
+     !get(md5, KEY_FORMAT, cached) || (cached != "NTSC" && cached != "PAL"))
+    return false;
+
+  format = cached;
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AutodetectCache::setDisplayFormat(const string& md5, const string& bsType,
+                                       const string& format)
+{
+  set(md5, KEY_FORMAT_BANKSWITCH, bsType);
+  set(md5, KEY_FORMAT, format);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool AutodetectCache::get(const string& md5, const string& key, string& value) const
+{
+  if(md5 == EmptyString)
+    return false;
+
+  Variant version, result;
+  if(!myRepository->get(md5, KEY_VERSION, version) ||
+     version.toString() != STELLA_VERSION ||
+     !myRepository->get(md5, key, result))
+    return false;
+
+  value = result.toString();
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AutodetectCache::set(const string& md5, const string& key, const string& value)
+{
+  if(md5 == EmptyString)
+    return;
+
+  Variant version;
+  if(!myRepository->get(md5, KEY_VERSION, version) ||
+     version.toString() != STELLA_VERSION)
+  {
+    // Results of older versions might be wrong now, so drop all of them
+    myRepository->remove(md5);
+    myRepository->save(md5, KEY_VERSION, STELLA_VERSION);
+  }
+  myRepository->save(md5, key, value);
+}
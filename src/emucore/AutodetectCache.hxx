@@ -0,0 +1,92 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef AUTODETECT_CACHE_HXX
+#define AUTODETECT_CACHE_HXX
+
+#include "bspf.hxx"
+#include "Bankswitch.hxx"
+#include "Control.hxx"
+#include "repository/CompositeKeyValueRepository.hxx"
+
+/**
+  This class remembers the results of the (rather expensive) bankswitch,
+  controller and display format autodetection for each ROM, keyed by the
+  ROM md5.  The results are stored in a persistent repository, so that
+  ROMs which were started before don't have to be analyzed and emulated
+  again.
+
+  Since the autodetection may change between releases, all results stored
+  by a different version of Stella are ignored and replaced.
+*/
+class AutodetectCache
+{
+  public:
+    AutodetectCache();
+
+    void setRepository(shared_ptr<CompositeKeyValueRepositoryAtomic> repository);
+
+    /**
+      Get/set the autodetected bankswitch type of the given ROM.
+
+      @return  True if a cached result was found, else false
+    */
+    bool getBankswitch(const string& md5, Bankswitch::Type& type) const;
+    void setBankswitch(const string& md5, Bankswitch::Type type);
+
+    /**
+      Get/set the autodetected controller type for the given port.
+
+      @return  True if a cached result was found, else false
+    */
+    bool getController(const string& md5, Controller::Jack port,
+                       Controller::Type& type) const;
+    void setController(const string& md5, Controller::Jack port,
+                       Controller::Type type);
+
+    /**
+      Get/set the autodetected display format ("NTSC" or "PAL").  Since the
+      format is detected by emulating the ROM, the result is only valid
+      for the bankswitch type used when it was detected.
+
+      @return  True if a cached result was found, else false
+    */
+    bool getDisplayFormat(const string& md5, const string& bsType,
+                          string& format) const;
+    void setDisplayFormat(const string& md5, const string& bsType,
+                          const string& format);
+
+  private:
+    // Read a value of the entry for the given md5, if it is still valid
+    bool get(const string& md5, const string& key, string& value) const;
+
+    // Write a value of the entry for the given md5, removing any outdated
+    // values first
+    void set(const string& md5, const string& key, const string& value);
+
+  private:
+    shared_ptr<CompositeKeyValueRepositoryAtomic> myRepository;
+
+  private:
+    // Following constructors and assignment operators not supported
+    AutodetectCache(const AutodetectCache&) = delete;
+    AutodetectCache(AutodetectCache&&) = delete;
+    AutodetectCache& operator=(const AutodetectCache&) = delete;
+    AutodetectCache& operator=(AutodetectCache&&) = delete;
+};
+
+#endif
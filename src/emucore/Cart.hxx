@@ -25,6 +25,7 @@ class CartDebugWidget;
 class CartRamWidget;
 class GuiObject;
 class Settings;
+class Thumbulator;
 
 #include <functional>
 
@@ -274,6 +275,13 @@ class Cartridge : public Device
     */
     virtual uInt32 thumbCallback(uInt8 function, uInt32 value1, uInt32 value2) { return 0; }
 
+    /**
+      Get the ARM emulation of carts which run code on the Harmony/Melody.
+
+      @return  The Thumbulator used by the cart, or nullptr if there is none
+    */
+    virtual Thumbulator* thumbulator() const { return nullptr; }
+
   #ifdef DEBUGGER_SUPPORT
     /**
       Get optional debugger widget responsible for displaying info about the cart.
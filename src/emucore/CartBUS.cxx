@@ -20,6 +20,7 @@
 #ifdef DEBUGGER_SUPPORT
   #include "Debugger.hxx"
 #endif
+#include "RomCache.hxx"
 #include "System.hxx"
 #include "M6532.hxx"
 #include "TIA.hxx"
@@ -43,11 +44,14 @@
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 CartridgeBUS::CartridgeBUS(const ByteBuffer& image, size_t size,
                            const string& md5, const Settings& settings)
-  : Cartridge(settings, md5),
-    myImage{make_unique<uInt8[]>(32_KB)}
+  : Cartridge(settings, md5)
 {
-  // Copy the ROM image into my buffer
-  std::copy_n(image.get(), std::min(32_KB, size), myImage.get());
+  // Borrow the ROM image from the cache, which shares it with all other
+  // instances running this ROM
+  const string romKey = md5 + "/BUS";
+  myImage = RomCache::image(romKey, 32_KB, [&](uInt8* buffer) {
+    std::copy_n(image.get(), std::min(32_KB, size), buffer);
+  });
 
   // Even though the ROM is 32K, only 28K is accessible to the 6507
   createRomAccessArrays(28_KB);
@@ -68,6 +72,7 @@ CartridgeBUS::CartridgeBUS(const ByteBuffer& image, size_t size,
     reinterpret_cast<uInt16*>(myImage.get()),
     reinterpret_cast<uInt16*>(myRAM.data()),
     static_cast<uInt32>(32_KB),
+    romKey,
     0x00000800,
     0x00000808,
     0x40001FDC,
@@ -475,6 +480,12 @@ bool CartridgeBUS::patch(uInt16 address, uInt8 value)
   // For now, we ignore attempts to patch the BUS address space
   if(address >= 0x0040)
   {
+    // A ROM image shared with other instances must be copied first
+    if(RomCache::unshare(myImage, 32_KB))
+    {
+      myProgramImage = myImage.get() + 4_KB;
+      myThumbEmulator->setRom(reinterpret_cast<uInt16*>(myImage.get()));
+    }
     myProgramImage[myBankOffset + (address & 0x0FFF)] = value;
     return myBankChanged = true;
   }
@@ -23,6 +23,7 @@
   #include "CartCDFInfoWidget.hxx"
 #endif
 
+#include "RomCache.hxx"
 #include "System.hxx"
 #include "Thumbulator.hxx"
 #include "CartCDF.hxx"
@@ -67,10 +68,13 @@ CartridgeCDF::CartridgeCDF(const ByteBuffer& image, size_t size,
                            const string& md5, const Settings& settings)
   : Cartridge(settings, md5)
 {
-  // Copy the ROM image into my buffer
+  // Borrow the ROM image from the cache, which shares it with all other
+  // instances running this ROM
   mySize = std::min(size, 512_KB);
-  myImage = make_unique<uInt8[]>(mySize);
-  std::copy_n(image.get(), mySize, myImage.get());
+  const string romKey = md5 + "/CDF";
+  myImage = RomCache::image(romKey, mySize, [&](uInt8* buffer) {
+    std::copy_n(image.get(), mySize, buffer);
+  });
 
   // Detect cart version
   setupVersion();
@@ -106,6 +110,7 @@ CartridgeCDF::CartridgeCDF(const ByteBuffer& image, size_t size,
     reinterpret_cast<uInt16*>(myImage.get()),
     reinterpret_cast<uInt16*>(myRAM.data()),
     static_cast<uInt32>(mySize),
+    romKey,
     cBase, cStart, cStack,
     devSettings ? settings.getBool("dev.thumb.trapfatal") : false,
     thumulatorConfiguration(myCDFSubtype),
@@ -475,6 +480,12 @@ bool CartridgeCDF::patch(uInt16 address, uInt8 value)
   // For now, we ignore attempts to patch the CDF address space
   if(address >= 0x0040)
   {
+    // A ROM image shared with other instances must be copied first
+    if(RomCache::unshare(myImage, mySize))
+    {
+      myProgramImage = myImage.get() + (isCDFJplus() ? 2_KB : 4_KB);
+      myThumbEmulator->setRom(reinterpret_cast<uInt16*>(myImage.get()));
+    }
     myProgramImage[myBankOffset + (address & 0x0FFF)] = value;
     return myBankChanged = true;
   }
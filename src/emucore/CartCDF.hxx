@@ -170,6 +170,11 @@ class CartridgeCDF : public Cartridge
     */
     uInt32 thumbCallback(uInt8 function, uInt32 value1, uInt32 value2) override;
 
+    /**
+      Get the ARM emulation of the cart.
+    */
+    Thumbulator* thumbulator() const override { return myThumbEmulator.get(); }
+
     /**
       Query the internal RAM size of the cart.
 
@@ -64,6 +64,7 @@
 #include "Props.hxx"
 #include "Logger.hxx"
 #include "OSystem.hxx"
+#include "AutodetectCache.hxx"
 
 #include "CartDetector.hxx"
 #include "CartCreator.hxx"
@@ -71,7 +72,7 @@
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 unique_ptr<Cartridge> CartCreator::create(const FilesystemNode& file,
     const ByteBuffer& image, size_t size, string& md5,
-    const string& propertiesType, Settings& settings)
+    const string& propertiesType, Settings& settings, AutodetectCache* cache)
 {
   unique_ptr<Cartridge> cartridge;
   Bankswitch::Type type = Bankswitch::nameToType(propertiesType),
@@ -91,7 +92,14 @@ unique_ptr<Cartridge> CartCreator::create(const FilesystemNode& file,
   // If we ask for extended info, always do an autodetect
   if(type == Bankswitch::Type::_AUTO || settings.getBool("rominfo"))
   {
-    detectedType = CartDetector::autodetectType(image, size);
+    // Skip the (cached) autodetection unless we want to see its results
+    if(cache == nullptr || settings.getBool("rominfo") ||
+       !cache->getBankswitch(md5, detectedType))
+    {
+      detectedType = CartDetector::autodetectType(image, size);
+      if(cache != nullptr)
+        cache->setBankswitch(md5, detectedType);
+    }
     if(type != Bankswitch::Type::_AUTO && type != detectedType)
       cerr << "Auto-detection not consistent: "
            << Bankswitch::typeToName(type) << ", "
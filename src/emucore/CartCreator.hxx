@@ -18,6 +18,7 @@
 #ifndef CARTRIDGE_CREATOR_HXX
 #define CARTRIDGE_CREATOR_HXX
 
+class AutodetectCache;
 class Cartridge;
 class Properties;
 class Settings;
@@ -43,11 +44,13 @@ class CartCreator
       @param md5      The md5sum for the given ROM image (can be updated)
       @param dtype    The detected bankswitch type of the ROM image
       @param settings The settings container
+      @param cache    Optional cache for autodetection results
       @return   Pointer to the new cartridge object allocated on the heap
     */
     static unique_ptr<Cartridge> create(const FilesystemNode& file,
                  const ByteBuffer& image, size_t size, string& md5,
-                 const string& dtype, Settings& settings);
+                 const string& dtype, Settings& settings,
+                 AutodetectCache* cache = nullptr);
 
   private:
     /**
@@ -19,6 +19,7 @@
   #include "Debugger.hxx"
 #endif
 #include "MD5.hxx"
+#include "RomCache.hxx"
 #include "System.hxx"
 #include "Thumbulator.hxx"
 #include "CartDPCPlus.hxx"
@@ -29,14 +30,17 @@
 CartridgeDPCPlus::CartridgeDPCPlus(const ByteBuffer& image, size_t size,
                                    const string& md5, const Settings& settings)
   : Cartridge(settings, md5),
-    myImage{make_unique<uInt8[]>(32_KB)},
     mySize{std::min(size, 32_KB)}
 {
   // Image is always 32K, but in the case of ROM < 32K, the image is
   // copied to the end of the buffer
-  if(mySize < 32_KB)
-    std::fill_n(myImage.get(), mySize, 0);
-  std::copy_n(image.get(), size, myImage.get() + (32_KB - mySize));
+  // The image is borrowed from the cache, which shares it with all other
+  // instances running this ROM
+  const string romKey = md5 + "/DPC+";
+  myImage = RomCache::image(romKey, 32_KB, [&](uInt8* buffer) {
+    std::fill_n(buffer, 32_KB - mySize, 0);
+    std::copy_n(image.get(), mySize, buffer + (32_KB - mySize));
+  });
   createRomAccessArrays(24_KB);
 
   // Pointer to the program ROM (24K @ 3K offset; ignore first 3K)
@@ -54,6 +58,7 @@ CartridgeDPCPlus::CartridgeDPCPlus(const ByteBuffer& image, size_t size,
       (reinterpret_cast<uInt16*>(myImage.get()),
        reinterpret_cast<uInt16*>(myDPCRAM.data()),
        static_cast<uInt32>(32_KB),
+       romKey,
       0x00000C00,
       0x00000C08,
       0x40001FDC,
@@ -636,6 +641,12 @@ bool CartridgeDPCPlus::patch(uInt16 address, uInt8 value)
   // For now, we ignore attempts to patch the DPC address space
   if(address >= 0x0080)
   {
+    // A ROM image shared with other instances must be copied first
+    if(RomCache::unshare(myImage, 32_KB))
+    {
+      myProgramImage = myImage.get() + 3_KB;
+      myThumbEmulator->setRom(reinterpret_cast<uInt16*>(myImage.get()));
+    }
     myProgramImage[myBankOffset + (address & 0x0FFF)] = value;
     return myBankChanged = true;
   }
@@ -145,6 +145,11 @@ class CartridgeDPCPlus : public Cartridge
     */
     string name() const override { return "CartridgeDPC+"; }
 
+    /**
+      Get the ARM emulation of the cart.
+    */
+    Thumbulator* thumbulator() const override { return myThumbEmulator.get(); }
+
     /**
       Query the internal RAM size of the cart.
 
@@ -23,6 +23,15 @@
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Bankswitch::Type CartDetector::autodetectType(const ByteBuffer& image, size_t size)
 {
+  // Scan the image only once; all signature searches use the index
+  return autodetectType(SignatureIndex(image, size));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Bankswitch::Type CartDetector::autodetectType(const SignatureIndex& image)
+{
+  const size_t size = image.size();
+
   // Guess type based on size
   Bankswitch::Type type = Bankswitch::Type::_AUTO;
 
@@ -280,7 +289,7 @@ bool CartDetector::searchForBytes(const uInt8* image, size_t imagesize,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablySC(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablySC(const SignatureIndex& image, size_t size)
 {
   // We assume a Superchip cart repeats the first 128 bytes for the second
   // 128 bytes in the RAM area, which is the first 256 bytes of each 4K bank
@@ -297,7 +306,7 @@ bool CartDetector::isProbablySC(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyARM(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyARM(const SignatureIndex& image, size_t size)
 {
   // ARM code contains the following 'loader' patterns in the first 1K
   // Thanks to Thomas Jentzsch of AtariAge for this advice
@@ -312,7 +321,7 @@ bool CartDetector::isProbablyARM(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably0840(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably0840(const SignatureIndex& image, size_t size)
 {
   // 0840 cart bankswitching is triggered by accessing addresses 0x0800
   // or 0x0840 at least twice
@@ -337,7 +346,7 @@ bool CartDetector::isProbably0840(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3E(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3E(const SignatureIndex& image, size_t size)
 {
   // 3E cart RAM bankswitching is triggered by storing the bank number
   // in address 3E using 'STA $3E', ROM bankswitching is triggered by
@@ -352,7 +361,7 @@ bool CartDetector::isProbably3E(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3EX(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3EX(const SignatureIndex& image, size_t size)
 {
   // 3EX cart have at least 2 occurrences of the string "3EX"
   uInt8 _3EX[] = { '3', 'E', 'X'};
@@ -360,7 +369,7 @@ bool CartDetector::isProbably3EX(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3EPlus(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3EPlus(const SignatureIndex& image, size_t size)
 {
   // 3E+ cart is identified key 'TJ3E' in the ROM
   uInt8 tj3e[] = { 'T', 'J', '3', 'E' };
@@ -368,7 +377,7 @@ bool CartDetector::isProbably3EPlus(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3F(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3F(const SignatureIndex& image, size_t size)
 {
   // 3F cart bankswitching is triggered by storing the bank number
   // in address 3F using 'STA $3F'
@@ -379,7 +388,7 @@ bool CartDetector::isProbably3F(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably4A50(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably4A50(const SignatureIndex& image, size_t size)
 {
   // 4A50 carts store address $4A50 at the NMI vector, which
   // in this scheme is always in the last page of ROM at
@@ -397,7 +406,7 @@ bool CartDetector::isProbably4A50(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably4KSC(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably4KSC(const SignatureIndex& image, size_t size)
 {
   // We check if the first 256 bytes are identical *and* if there's
   // an "SC" signature for one of our larger SC types at 1FFA.
@@ -414,7 +423,7 @@ bool CartDetector::isProbably4KSC(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyBF(const ByteBuffer& image, size_t size,
+bool CartDetector::isProbablyBF(const SignatureIndex& image, size_t size,
                                 Bankswitch::Type& type)
 {
   // BF carts store strings 'BFBF' and 'BFSC' starting at address $FFF8
@@ -436,7 +445,7 @@ bool CartDetector::isProbablyBF(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyBUS(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyBUS(const SignatureIndex& image, size_t size)
 {
   // BUS ARM code has 2 occurrences of the string BUS
   // Note: all Harmony/Melody custom drivers also contain the value
@@ -446,7 +455,7 @@ bool CartDetector::isProbablyBUS(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCDF(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyCDF(const SignatureIndex& image, size_t size)
 {
   // CDF ARM code has 3 occurrences of the string CDF
   // Note: all Harmony/Melody custom drivers also contain the value
@@ -458,14 +467,14 @@ bool CartDetector::isProbablyCDF(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCTY(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyCTY(const SignatureIndex& image, size_t size)
 {
   uInt8 lenin[] = { 'L', 'E', 'N', 'I', 'N' };
   return searchForBytes(image, size, lenin, 5);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCV(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyCV(const SignatureIndex& image, size_t size)
 {
   // CV RAM access occurs at addresses $f3ff and $f400
   // These signatures are attributed to the MESS project
@@ -480,7 +489,7 @@ bool CartDetector::isProbablyCV(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyDF(const ByteBuffer& image, size_t size,
+bool CartDetector::isProbablyDF(const SignatureIndex& image, size_t size,
                                 Bankswitch::Type& type)
 {
 
@@ -503,7 +512,7 @@ bool CartDetector::isProbablyDF(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyDPCplus(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyDPCplus(const SignatureIndex& image, size_t size)
 {
   // DPC+ ARM code has 2 occurrences of the string DPC+
   // Note: all Harmony/Melody custom drivers also contain the value
@@ -513,7 +522,7 @@ bool CartDetector::isProbablyDPCplus(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE0(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyE0(const SignatureIndex& image, size_t size)
 {
   // E0 cart bankswitching is triggered by accessing addresses
   // $FE0 to $FF9 using absolute non-indexed addressing
@@ -539,7 +548,7 @@ bool CartDetector::isProbablyE0(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE7(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyE7(const SignatureIndex& image, size_t size)
 {
   // E7 cart bankswitching is triggered by accessing addresses
   // $FE0 to $FE6 using absolute non-indexed addressing
@@ -564,7 +573,7 @@ bool CartDetector::isProbablyE7(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE78K(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyE78K(const SignatureIndex& image, size_t size)
 {
   // E78K cart bankswitching is triggered by accessing addresses
   // $FE4 to $FE6 using absolute non-indexed addressing
@@ -583,7 +592,7 @@ bool CartDetector::isProbablyE78K(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyEF(const ByteBuffer& image, size_t size,
+bool CartDetector::isProbablyEF(const SignatureIndex& image, size_t size,
                                 Bankswitch::Type& type)
 {
   // Newer EF carts store strings 'EFEF' and 'EFSC' starting at address $FFF8
@@ -632,7 +641,7 @@ bool CartDetector::isProbablyEF(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyFA2(const ByteBuffer& image, size_t)
+bool CartDetector::isProbablyFA2(const SignatureIndex& image, size_t)
 {
   // This currently tests only the 32K version of FA2; the 24 and 28K
   // versions are easy, in that they're the only possibility with those
@@ -647,7 +656,7 @@ bool CartDetector::isProbablyFA2(const ByteBuffer& image, size_t)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyFC(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyFC(const SignatureIndex& image, size_t size)
 {
   // FC bankswitching uses consecutive writes to 3 hotspots
   uInt8 signature[3][6] = {
@@ -663,7 +672,7 @@ bool CartDetector::isProbablyFC(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyFE(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyFE(const SignatureIndex& image, size_t size)
 {
   // FE bankswitching is very weird, but always seems to include a
   // 'JSR $xxxx'
@@ -682,7 +691,7 @@ bool CartDetector::isProbablyFE(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyMDM(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyMDM(const SignatureIndex& image, size_t size)
 {
   // MDM cart is identified key 'MDMC' in the first 8K of ROM
   uInt8 mdmc[] = { 'M', 'D', 'M', 'C' };
@@ -690,7 +699,7 @@ bool CartDetector::isProbablyMDM(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablySB(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablySB(const SignatureIndex& image, size_t size)
 {
   // SB cart bankswitching switches banks by accessing address 0x0800
   uInt8 signature[2][3] = {
@@ -704,7 +713,7 @@ bool CartDetector::isProbablySB(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyTVBoy(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyTVBoy(const SignatureIndex& image, size_t size)
 {
   // TV Boy cart bankswitching switches banks by accessing addresses 0x1800..$187F
   uInt8 signature[5] = {0x91, 0x82, 0x6c, 0xfc, 0xff};  // STA ($82),Y; JMP ($FFFC)
@@ -712,7 +721,7 @@ bool CartDetector::isProbablyTVBoy(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyUA(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyUA(const SignatureIndex& image, size_t size)
 {
   // UA cart bankswitching switches to bank 1 by accessing address 0x240
   // using 'STA $240' or 'LDA $240'
@@ -737,7 +746,7 @@ bool CartDetector::isProbablyUA(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyWD(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyWD(const SignatureIndex& image, size_t size)
 {
   // WD cart bankswitching switches banks by accessing address 0x30..0x3f
   uInt8 signature[1][3] = {
@@ -747,7 +756,7 @@ bool CartDetector::isProbablyWD(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyX07(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyX07(const SignatureIndex& image, size_t size)
 {
   // X07 bankswitching switches to bank 0, 1, 2, etc by accessing address 0x08xd
   uInt8 signature[6][3] = {
@@ -126,6 +126,8 @@ void CartridgeEnhanced::install(System& system)
     }
   }
 
+  createPageAccessTables();
+
   // Install pages for the startup bank (TODO: currently only in first bank segment)
   bank(startBank(), 0);
   if(mySize >= 4_KB && myBankSegs > 1)
@@ -133,6 +135,47 @@ void CartridgeEnhanced::install(System& system)
     bank(romBankCount() - 1, myBankSegs - 1);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeEnhanced::createPageAccessTables()
+{
+  // ROM pages; the hotspot page is handled in bank()
+  System::PageAccess access(this, System::PageAccessType::READ);
+
+  myRomPageAccess.resize(mySize >> System::PAGE_SHIFT);
+  for(size_t page = 0; page < myRomPageAccess.size(); ++page)
+  {
+    const size_t offset = page << System::PAGE_SHIFT;
+
+    access.directPeekBase = myDirectPeek ? &myImage[offset] : nullptr;
+    access.romAccessBase = &myRomAccessBase[offset];
+    access.romPeekCounter = &myRomAccessCounter[offset];
+    access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
+    myRomPageAccess[page] = access;
+  }
+
+  // Banked RAM pages, both ports share the same access arrays
+  const size_t ramPages = myRamBankCount > 0 ? myRamSize >> System::PAGE_SHIFT : 0;
+
+  myRamWritePageAccess.resize(ramPages);
+  myRamReadPageAccess.resize(ramPages);
+  for(size_t page = 0; page < ramPages; ++page)
+  {
+    const size_t offset = page << System::PAGE_SHIFT;
+
+    // Note: Writes are mapped to poke() (NOT using directPokeBase) to check for read from write port (RWP)
+    access.type = System::PageAccessType::WRITE;
+    access.directPeekBase = nullptr;
+    access.romAccessBase = &myRomAccessBase[mySize + offset];
+    access.romPeekCounter = &myRomAccessCounter[mySize + offset];
+    access.romPokeCounter = &myRomAccessCounter[mySize + offset + myAccessSize];
+    myRamWritePageAccess[page] = access;
+
+    access.type = System::PageAccessType::READ;
+    access.directPeekBase = &myRAM[offset];
+    myRamReadPageAccess[page] = access;
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void CartridgeEnhanced::reset()
 {
@@ -258,20 +301,22 @@ bool CartridgeEnhanced::bank(uInt16 bank, uInt16 segment)
     else
       hotSpotAddr = 0xFFFF; // none
 
-    System::PageAccess access(this, System::PageAccessType::READ);
     // Setup the page access methods for the current bank
     for(uInt16 addr = fromAddr; addr < toAddr; addr += System::PAGE_SIZE)
     {
-      const uInt32 offset = bankOffset + (addr & myBankMask);
+      const System::PageAccess& access =
+        myRomPageAccess[(bankOffset + (addr & myBankMask)) >> System::PAGE_SHIFT];
 
-      if(myDirectPeek && addr != hotSpotAddr)
-        access.directPeekBase = &myImage[offset];
+      if(addr != hotSpotAddr)
+        mySystem->setPageAccess(addr, access);
       else
-        access.directPeekBase = nullptr;
-      access.romAccessBase = &myRomAccessBase[offset];
-      access.romPeekCounter = &myRomAccessCounter[offset];
-      access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
-      mySystem->setPageAccess(addr, access);
+      {
+        // The hotspot page must always be mapped to peek()
+        System::PageAccess hotSpotAccess = access;
+
+        hotSpotAccess.directPeekBase = nullptr;
+        mySystem->setPageAccess(addr, hotSpotAccess);
+      }
     }
   }
   else
@@ -285,36 +330,20 @@ bool CartridgeEnhanced::bank(uInt16 bank, uInt16 segment)
     myCurrentSegOffset[segment] = uInt32(mySize) + (ramBank << myBankShift);
 
     // Set the page accessing method for the RAM writing pages
-    // Note: Writes are mapped to poke() (NOT using directPokeBase) to check for read from write port (RWP)
     uInt16 fromAddr = (ROM_OFFSET + segmentOffset + myWriteOffset) & ~System::PAGE_MASK;
     uInt16 toAddr   = (ROM_OFFSET + segmentOffset + myWriteOffset + (myBankSize >> 1)) & ~System::PAGE_MASK;
-    System::PageAccess access(this, System::PageAccessType::WRITE);
 
     for(uInt16 addr = fromAddr; addr < toAddr; addr += System::PAGE_SIZE)
-    {
-      const uInt32 offset = bankOffset + (addr & myRamMask);
-
-      access.romAccessBase = &myRomAccessBase[offset];
-      access.romPeekCounter = &myRomAccessCounter[offset];
-      access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
-      mySystem->setPageAccess(addr, access);
-    }
+      mySystem->setPageAccess(addr, myRamWritePageAccess[
+        (bankOffset - mySize + (addr & myRamMask)) >> System::PAGE_SHIFT]);
 
     // Set the page accessing method for the RAM reading pages
     fromAddr = (ROM_OFFSET + segmentOffset + myReadOffset) & ~System::PAGE_MASK;
     toAddr   = (ROM_OFFSET + segmentOffset + myReadOffset + (myBankSize >> 1)) & ~System::PAGE_MASK;
-    access.type = System::PageAccessType::READ;
 
     for(uInt16 addr = fromAddr; addr < toAddr; addr += System::PAGE_SIZE)
-    {
-      const uInt32 offset = bankOffset + (addr & myRamMask);
-
-      access.directPeekBase = &myRAM[offset - mySize];
-      access.romAccessBase = &myRomAccessBase[offset];
-      access.romPeekCounter = &myRomAccessCounter[offset];
-      access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
-      mySystem->setPageAccess(addr, access);
-    }
+      mySystem->setPageAccess(addr, myRamReadPageAccess[
+        (bankOffset - mySize + (addr & myRamMask)) >> System::PAGE_SHIFT]);
   }
   return myBankChanged = true;
 }
@@ -18,10 +18,9 @@
 #ifndef CARTRIDGEENHANCED_HXX
 #define CARTRIDGEENHANCED_HXX
 
-class System;
-
 #include "bspf.hxx"
 #include "Cart.hxx"
+#include "System.hxx"
 #include "PlusROM.hxx"
 #ifdef DEBUGGER_SUPPORT
   #include "CartEnhancedWidget.hxx"
@@ -228,6 +227,16 @@ class CartridgeEnhanced : public Cartridge
     // Handle PlusROM functionality, if available
     PlusROM myPlusROM;
 
+  private:
+    // Precomputed page accesses for each page of the ROM image, indexed by
+    // (image offset >> System::PAGE_SHIFT); a bank switch only copies these
+    std::vector<System::PageAccess> myRomPageAccess;
+
+    // Precomputed page accesses for the write and read ports of each page of
+    // the banked RAM, indexed by (RAM offset >> System::PAGE_SHIFT)
+    std::vector<System::PageAccess> myRamWritePageAccess;
+    std::vector<System::PageAccess> myRamReadPageAccess;
+
   protected:
     // The mask for 6507 address space
     static constexpr uInt16 ADDR_MASK = 0x1FFF;
@@ -273,6 +282,12 @@ class CartridgeEnhanced : public Cartridge
     */
     virtual uInt16 getStartBank() const { return 0; }
 
+    /**
+      Precompute the page accesses for all ROM and banked RAM pages, so that
+      bank() only has to copy them into the system's page table.
+    */
+    void createPageAccessTables();
+
     /**
       Get the ROM offset of the segment of the given address
 
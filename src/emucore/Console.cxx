@@ -46,6 +46,7 @@
 #include "Paddles.hxx"
 #include "Props.hxx"
 #include "PropsSet.hxx"
+#include "AutodetectCache.hxx"
 #include "SaveKey.hxx"
 #include "Settings.hxx"
 #include "Sound.hxx"
@@ -270,6 +271,14 @@ void Console::setConsoleTiming()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Console::autodetectFrameLayout(bool reset)
 {
+  // Use the result of a previous run, if there is one
+  AutodetectCache& cache = myOSystem.autodetectCache();
+  const string& md5 = myProperties.get(PropType::Cart_MD5);
+
+  if(!myOSystem.settings().getBool("rominfo") &&
+     cache.getDisplayFormat(md5, myCart->detectedType(), myDisplayFormat))
+    return;
+
   // Run the TIA, looking for PAL scanline patterns
   // We turn off the SuperCharger progress bars, otherwise the SC BIOS
   // will take over 250 frames!
@@ -285,11 +294,14 @@ void Console::autodetectFrameLayout(bool reset)
     myRiot->update();
   }
 
-  for(int i = 0; i < 60; ++i) myTIA->update();
+  // Stop as soon as the result is certain, but never run more than 60 frames
+  for(int i = 0; i < 60 && frameLayoutDetector.confidence() < 100; ++i)
+    myTIA->update();
 
   myTIA->setFrameManager(myFrameManager.get());
 
   myDisplayFormat = frameLayoutDetector.detectedLayout() == FrameLayout::pal ? "PAL" : "NTSC";
+  cache.setDisplayFormat(md5, myCart->detectedType(), myDisplayFormat);
 
   // Don't forget to reset the SC progress bars again
   myOSystem.settings().setValue("fastscbios", fastscbios);
@@ -822,14 +834,31 @@ void Console::setControllers(const string& romMd5)
     const bool swappedPorts =
         myProperties.get(PropType::Console_SwapPorts) == "YES";
 
-    // Try to detect controllers
+    // Try to detect controllers, unless the results are already cached
+    const auto detectType = [&](Controller::Type type, Controller::Jack port)
+    {
+      AutodetectCache& cache = myOSystem.autodetectCache();
+      const bool autodetect = type == Controller::Type::Unknown;
+
+      if(autodetect && !myOSystem.settings().getBool("rominfo") &&
+         cache.getController(romMd5, port, type))
+        return type;
+
+      type = ControllerDetector::detectType(image, size, type, port,
+                                            myOSystem.settings());
+      if(autodetect)
+        cache.setController(romMd5, port, type);
+
+      return type;
+    };
+
     if(image != nullptr && size != 0)
     {
       Logger::debug(myProperties.get(PropType::Cart_Name) + ":");
-      leftType = ControllerDetector::detectType(image, size, leftType,
-          !swappedPorts ? Controller::Jack::Left : Controller::Jack::Right, myOSystem.settings());
-      rightType = ControllerDetector::detectType(image, size, rightType,
-          !swappedPorts ? Controller::Jack::Right : Controller::Jack::Left, myOSystem.settings());
+      leftType = detectType(leftType,
+          !swappedPorts ? Controller::Jack::Left : Controller::Jack::Right);
+      rightType = detectType(rightType,
+          !swappedPorts ? Controller::Jack::Right : Controller::Jack::Left);
     }
 
     unique_ptr<Controller>
@@ -379,7 +379,8 @@ class Console : public Serializable, public ConsoleIO
     void setConsoleTiming();
 
     /**
-     * Dry-run the emulation and detect the frame layout (PAL / NTSC).
+     * Dry-run the emulation and detect the frame layout (PAL / NTSC),
+     * unless the result for this ROM is already cached.
      */
     void autodetectFrameLayout(bool reset = true);
 
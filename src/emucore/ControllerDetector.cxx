@@ -18,6 +18,7 @@
 
 #include "Settings.hxx"
 #include "Logger.hxx"
+#include "SignatureIndex.hxx"
 
 #include "ControllerDetector.hxx"
 
@@ -26,10 +27,23 @@ Controller::Type ControllerDetector::detectType(
     const ByteBuffer& image, size_t size,
     const Controller::Type type, const Controller::Jack port,
     const Settings& settings)
+{
+  // Only index the image when it is actually searched
+  if(type == Controller::Type::Unknown || settings.getBool("rominfo"))
+    return detectType(SignatureIndex(image, size), type, port, settings);
+
+  return type;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Controller::Type ControllerDetector::detectType(
+    const SignatureIndex& image,
+    const Controller::Type type, const Controller::Jack port,
+    const Settings& settings)
 {
   if(type == Controller::Type::Unknown || settings.getBool("rominfo"))
   {
-    Controller::Type detectedType = autodetectPort(image, size, port, settings);
+    Controller::Type detectedType = autodetectPort(image, port, settings);
 
     if(type != Controller::Type::Unknown && type != detectedType)
     {
@@ -52,11 +66,21 @@ string ControllerDetector::detectName(const ByteBuffer& image, size_t size,
   return Controller::getName(detectType(image, size, controller, port, settings));
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string ControllerDetector::detectName(const SignatureIndex& image,
+    const Controller::Type controller, const Controller::Jack port,
+    const Settings& settings)
+{
+  return Controller::getName(detectType(image, controller, port, settings));
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Controller::Type ControllerDetector::autodetectPort(
-    const ByteBuffer& image, size_t size,
+    const SignatureIndex& image,
     Controller::Jack port, const Settings& settings)
 {
+  const size_t size = image.size();
+
   // default type joystick
   Controller::Type type = Controller::Type::Joystick;
 
@@ -93,31 +117,14 @@ Controller::Type ControllerDetector::autodetectPort(
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::searchForBytes(const ByteBuffer& image, size_t imagesize,
+bool ControllerDetector::searchForBytes(const SignatureIndex& image, size_t imagesize,
                                         const uInt8* signature, uInt32 sigsize)
 {
-  if (imagesize >= sigsize)
-    for(uInt32 i = 0; i < imagesize - sigsize; ++i)
-    {
-      uInt32 matches = 0;
-      for(uInt32 j = 0; j < sigsize; ++j)
-      {
-        if(image[i + j] == signature[j])
-          ++matches;
-        else
-          break;
-      }
-      if(matches == sigsize)
-      {
-        return true;
-      }
-    }
-
-  return false;
+  return image.search(imagesize, signature, sigsize);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::usesJoystickButton(const ByteBuffer& image, size_t size,
+bool ControllerDetector::usesJoystickButton(const SignatureIndex& image, size_t size,
                                             Controller::Jack port)
 {
   if(port == Controller::Jack::Left)
@@ -248,7 +255,7 @@ bool ControllerDetector::usesJoystickButton(const ByteBuffer& image, size_t size
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::usesKeyboard(const ByteBuffer& image, size_t size,
+bool ControllerDetector::usesKeyboard(const SignatureIndex& image, size_t size,
                                       Controller::Jack port)
 {
   if(port == Controller::Jack::Left)
@@ -389,7 +396,7 @@ bool ControllerDetector::usesKeyboard(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::usesGenesisButton(const ByteBuffer& image, size_t size,
+bool ControllerDetector::usesGenesisButton(const SignatureIndex& image, size_t size,
                                            Controller::Jack port)
 {
   if(port == Controller::Jack::Left)
@@ -447,7 +454,7 @@ bool ControllerDetector::usesGenesisButton(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::usesPaddle(const ByteBuffer& image, size_t size,
+bool ControllerDetector::usesPaddle(const SignatureIndex& image, size_t size,
                                     Controller::Jack port, const Settings& settings)
 {
   if(port == Controller::Jack::Left)
@@ -556,7 +563,7 @@ bool ControllerDetector::usesPaddle(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::isProbablyTrakBall(const ByteBuffer& image, size_t size)
+bool ControllerDetector::isProbablyTrakBall(const SignatureIndex& image, size_t size)
 {
   // check for TrakBall tables
   const int NUM_SIGS = 3;
@@ -575,7 +582,7 @@ bool ControllerDetector::isProbablyTrakBall(const ByteBuffer& image, size_t size
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::isProbablyAtariMouse(const ByteBuffer& image, size_t size)
+bool ControllerDetector::isProbablyAtariMouse(const SignatureIndex& image, size_t size)
 {
   // check for Atari Mouse tables
   const int NUM_SIGS = 3;
@@ -594,7 +601,7 @@ bool ControllerDetector::isProbablyAtariMouse(const ByteBuffer& image, size_t si
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::isProbablyAmigaMouse(const ByteBuffer& image, size_t size)
+bool ControllerDetector::isProbablyAmigaMouse(const SignatureIndex& image, size_t size)
 {
   // check for Amiga Mouse tables
   const int NUM_SIGS = 4;
@@ -614,7 +621,7 @@ bool ControllerDetector::isProbablyAmigaMouse(const ByteBuffer& image, size_t si
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::isProbablySaveKey(const ByteBuffer& image, size_t size,
+bool ControllerDetector::isProbablySaveKey(const SignatureIndex& image, size_t size,
                                            Controller::Jack port)
 {
   // check for known SaveKey code, only supports right port
@@ -659,7 +666,7 @@ bool ControllerDetector::isProbablySaveKey(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::isProbablyLightGun(const ByteBuffer& image, size_t size,
+bool ControllerDetector::isProbablyLightGun(const SignatureIndex& image, size_t size,
                                             Controller::Jack port)
 {
   if (port == Controller::Jack::Left)
@@ -696,7 +703,7 @@ bool ControllerDetector::isProbablyLightGun(const ByteBuffer& image, size_t size
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ControllerDetector::isProbablyQuadTari(const ByteBuffer& image, size_t size,
+bool ControllerDetector::isProbablyQuadTari(const SignatureIndex& image, size_t size,
                                             Controller::Jack port)
 {
   {
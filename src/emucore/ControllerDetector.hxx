@@ -19,6 +19,7 @@
 #define CONTROLLER_DETECTOR_HXX
 
 class Settings;
+class SignatureIndex;
 
 #include "Control.hxx"
 
@@ -45,6 +46,20 @@ class ControllerDetector
         const Controller::Type controller, const Controller::Jack port,
         const Settings& settings);
 
+    /**
+      Same as above, but uses an existing index of the ROM image, so that
+      it can be shared between both ports and the cartridge detection.
+
+      @param image      The index of the ROM image
+      @param controller The provided controller type of the ROM image
+      @param port       The port to be checked
+      @param settings   A reference to the various settings (read-only)
+      @return   The detected controller type
+    */
+    static Controller::Type detectType(const SignatureIndex& image,
+        const Controller::Type controller, const Controller::Jack port,
+        const Settings& settings);
+
     /**
       Detects the controller type at the given port if no controller is provided
       and returns its name.
@@ -61,68 +76,72 @@ class ControllerDetector
         const Controller::Type type, const Controller::Jack port,
         const Settings& settings);
 
+    // Same as above, but uses an existing index of the ROM image
+    static string detectName(const SignatureIndex& image,
+        const Controller::Type type, const Controller::Jack port,
+        const Settings& settings);
+
   private:
     /**
       Detects the controller type at the given port.
 
-      @param image      A reference to the ROM image
-      @param size       The size of the ROM image
+      @param image      The index of the ROM image
       @param port       The port to be checked
       @param settings   A reference to the various settings (read-only)
 
       @return   The detected controller type
     */
-    static Controller::Type autodetectPort(const ByteBuffer& image, size_t size,
+    static Controller::Type autodetectPort(const SignatureIndex& image,
         Controller::Jack port, const Settings& settings);
 
     /**
       Search the image for the specified byte signature.
 
-      @param image      A pointer to the ROM image
+      @param image      The index of the ROM image
       @param imagesize  The size of the ROM image
       @param signature  The byte sequence to search for
       @param sigsize    The number of bytes in the signature
 
       @return  True if the signature was found, else false
     */
-    static bool searchForBytes(const ByteBuffer& image, size_t imagesize,
+    static bool searchForBytes(const SignatureIndex& image, size_t imagesize,
                                const uInt8* signature, uInt32 sigsize);
 
     // Returns true if the port's joystick button access code is found.
-    static bool usesJoystickButton(const ByteBuffer& image, size_t size,
+    static bool usesJoystickButton(const SignatureIndex& image, size_t size,
                                    Controller::Jack port);
 
     // Returns true if the port's keyboard access code is found.
-    static bool usesKeyboard(const ByteBuffer& image, size_t size,
+    static bool usesKeyboard(const SignatureIndex& image, size_t size,
                              Controller::Jack port);
 
     // Returns true if the port's 2nd Genesis button access code is found.
-    static bool usesGenesisButton(const ByteBuffer& image, size_t size,
+    static bool usesGenesisButton(const SignatureIndex& image, size_t size,
                                   Controller::Jack port);
 
     // Returns true if the port's paddle button access code is found.
-    static bool usesPaddle(const ByteBuffer& image, size_t size,
+    static bool usesPaddle(const SignatureIndex& image, size_t size,
                            Controller::Jack port, const Settings& settings);
 
     // Returns true if a Trak-Ball table is found.
-    static bool isProbablyTrakBall(const ByteBuffer& image, size_t size);
+    static bool isProbablyTrakBall(const SignatureIndex& image, size_t size);
 
     // Returns true if an Atari Mouse table is found.
-    static bool isProbablyAtariMouse(const ByteBuffer& image, size_t size);
+    static bool isProbablyAtariMouse(const SignatureIndex& image, size_t size);
 
     // Returns true if an Amiga Mouse table is found.
-    static bool isProbablyAmigaMouse(const ByteBuffer& image, size_t size);
+    static bool isProbablyAmigaMouse(const SignatureIndex& image, size_t size);
 
     // Returns true if a SaveKey code pattern is found.
-    static bool isProbablySaveKey(const ByteBuffer& image, size_t size,
+    static bool isProbablySaveKey(const SignatureIndex& image, size_t size,
                                   Controller::Jack port);
 
     // Returns true if a Lightgun code pattern is found
-    static bool isProbablyLightGun(const ByteBuffer& image, size_t size,
+    static bool isProbablyLightGun(const SignatureIndex& image, size_t size,
                                    Controller::Jack port);
 
     // Returns true if a QuadTari code pattern is found.
-    static bool isProbablyQuadTari(const ByteBuffer& image, size_t size,
+    static bool isProbablyQuadTari(const SignatureIndex& image, size_t size,
                                    Controller::Jack port);
 
   private:
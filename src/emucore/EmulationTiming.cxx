@@ -141,6 +141,12 @@ uInt32 EmulationTiming::audioSampleRate() const
   return myAudioSampleRate;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 EmulationTiming::nativeAudioSampleRate() const
+{
+  return myNativeAudioSampleRate;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt32 EmulationTiming::audioQueueCapacity() const
 {
@@ -172,11 +178,13 @@ void EmulationTiming::recalculate()
   switch (myConsoleTiming) {
     case ConsoleTiming::ntsc:
       myAudioSampleRate = uInt32(round(mySpeedFactor * 262 * 76 * 60) / 38);
+      myNativeAudioSampleRate = 262 * 76 * 60 / 38;
       break;
 
     case ConsoleTiming::pal:
     case ConsoleTiming::secam:
       myAudioSampleRate = uInt32(round(mySpeedFactor * 312 * 76 * 50) / 38);
+      myNativeAudioSampleRate = 312 * 76 * 50 / 38;
       break;
 
     default:
@@ -56,6 +56,9 @@ class EmulationTiming {
 
     uInt32 audioSampleRate() const;
 
+    // The rate the TIA produces samples at in emulated time (ie, at 100% speed)
+    uInt32 nativeAudioSampleRate() const;
+
     uInt32 audioQueueCapacity() const;
 
     uInt32 prebufferFragmentCount() const;
@@ -81,6 +84,7 @@ class EmulationTiming {
     uInt32 myCyclesPerSecond{0};
     uInt32 myAudioFragmentSize{0};
     uInt32 myAudioSampleRate{0};
+    uInt32 myNativeAudioSampleRate{0};
     uInt32 myAudioQueueCapacity{0};
     uInt32 myPrebufferFragmentCount{0};
 
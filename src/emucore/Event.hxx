@@ -166,6 +166,7 @@ class Event
       PreviousMouseControl,
       DecreaseMouseAxesRange, IncreaseMouseAxesRange,
       SALeftAxis0Value, SALeftAxis1Value, SARightAxis0Value, SARightAxis1Value,
+      ToggleVideoRecording,
       LastType
     };
 
@@ -63,6 +63,7 @@
   #include "DialogContainer.hxx"
   #include "Launcher.hxx"
   #include "TimeMachine.hxx"
+  #include "VideoRecorder.hxx"
   #include "FileListWidget.hxx"
   #include "ScrollBarWidget.hxx"
 #endif
@@ -71,7 +72,18 @@ using namespace std::placeholders;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 EventHandler::EventHandler(OSystem& osystem)
-  : myOSystem{osystem}
+  : myOSystem{osystem},
+    myPaletteSetting{osystem.settings().handle<string>("palette")},
+    myTVFilterSetting{osystem.settings().handle<int>("tv.filter")},
+    myUseMouseSetting{osystem.settings().handle<string>("usemouse")},
+    myCursorSetting{osystem.settings().handle<int>("cursor")},
+    myConfirmExitSetting{osystem.settings().handle<bool>("confirmexit")},
+    mySaveOnExitSetting{osystem.settings().handle<string>("saveonexit")},
+    myExitLauncherSetting{osystem.settings().handle<bool>("exitlauncher")},
+    myMinimalUISetting{osystem.settings().handle<bool>("minimal_ui")},
+    myDevSettingsSetting{osystem.settings().handle<bool>("dev.settings")},
+    myPlrTimeMachineSetting{osystem.settings().handle<bool>("plr.timemachine")},
+    myDevTimeMachineSetting{osystem.settings().handle<bool>("dev.timemachine")}
 {
 }
 
@@ -288,6 +300,11 @@ void EventHandler::poll(uInt64 time)
   }
 #endif
 
+#ifdef PNG_SUPPORT
+  // Show the results of snapshots written in the background
+  myOSystem.png().reportWrittenSnapshots();
+#endif
+
   // Turn off all mouse-related items; if they haven't been taken care of
   // in the previous ::update() methods, they're now invalid
   myEvent.set(Event::MouseAxisXMove, 0);
@@ -420,9 +437,9 @@ bool EventHandler::skipAVSetting() const
 {
   const bool isFullScreen = myOSystem.frameBuffer().fullScreen();
   const bool isCustomPalette =
-    myOSystem.settings().getString("palette") == PaletteHandler::SETTING_CUSTOM;
+    myPaletteSetting.get() == PaletteHandler::SETTING_CUSTOM;
   const bool isCustomFilter =
-    myOSystem.settings().getInt("tv.filter") == int(NTSCFilter::Preset::CUSTOM);
+    myTVFilterSetting.get() == int(NTSCFilter::Preset::CUSTOM);
 
   return (myAdjustSetting == AdjustSetting::OVERSCAN && !isFullScreen)
   #ifdef ADAPTABLE_REFRESH_SUPPORT
@@ -452,8 +469,8 @@ bool EventHandler::skipInputSetting() const
     myOSystem.console().leftController().type() == Controller::Type::Driving
     || myOSystem.console().rightController().type() == Controller::Type::Driving;
   const bool useMouse =
-    BSPF::equalsIgnoreCase("always", myOSystem.settings().getString("usemouse"))
-    || (BSPF::equalsIgnoreCase("analog", myOSystem.settings().getString("usemouse"))
+    BSPF::equalsIgnoreCase("always", myUseMouseSetting.get())
+    || (BSPF::equalsIgnoreCase("analog", myUseMouseSetting.get())
         && analog);
   const bool stelladapter = myPJoyHandler->hasStelladaptors();
 
@@ -1831,6 +1848,12 @@ void EventHandler::handleEvent(Event::Type event, Int32 value, bool repeated)
       if(pressed && !repeated) myOSystem.frameBuffer().tiaSurface().saveSnapShot();
       return;
 
+  #ifdef GUI_SUPPORT
+    case Event::ToggleVideoRecording:
+      if(pressed && !repeated) myOSystem.videoRecorder().toggleRecording();
+      return;
+  #endif
+
     case Event::ExitMode:
       // Special handling for Escape key
       // Basically, exit whichever mode we're currently in
@@ -1860,13 +1883,11 @@ void EventHandler::handleEvent(Event::Type event, Int32 value, bool repeated)
             if (myState == EventHandlerState::EMULATION)
             {
 #ifdef GUI_SUPPORT
-              if (myOSystem.settings().getBool("confirmexit"))
+              if (myConfirmExitSetting.get())
               {
                 StringList msg;
-                const string saveOnExit = myOSystem.settings().getString("saveonexit");
-                bool activeTM = myOSystem.settings().getBool(
-                  myOSystem.settings().getBool("dev.settings") ? "dev.timemachine" : "plr.timemachine");
-
+                const string& saveOnExit = mySaveOnExitSetting.get();
+                const bool activeTM = timeMachineActive();
 
                 msg.push_back("Do you really want to exit emulation?");
                 if (saveOnExit != "all" || !activeTM)
@@ -2144,7 +2165,7 @@ bool EventHandler::changeStateByEvent(Event::Type type)
       if(myState == EventHandlerState::EMULATION || myState == EventHandlerState::PAUSE
          || myState == EventHandlerState::TIMEMACHINE || myState == EventHandlerState::PLAYBACK)
         enterMenuMode(EventHandlerState::CMDMENU);
-      else if(myState == EventHandlerState::CMDMENU && !myOSystem.settings().getBool("minimal_ui"))
+      else if(myState == EventHandlerState::CMDMENU && !myMinimalUISetting.get())
         // The extra check for "minimal_ui" allows mapping e.g. right joystick fire
         //  to open the command dialog and navigate there using that fire button
         leaveMenuMode();
@@ -2776,7 +2797,7 @@ void EventHandler::changeMouseControllerMode(int direction)
   const int NUM_MODES = 3;
   const string MODES[NUM_MODES] = {"always", "analog", "never"};
   const string MSG[NUM_MODES] = {"all", "analog", "no"};
-  string usemouse = myOSystem.settings().getString("usemouse");
+  string usemouse = myUseMouseSetting.get();
 
   int i = 0;
   for(auto& mode : MODES)
@@ -2801,7 +2822,7 @@ void EventHandler::changeMouseControllerMode(int direction)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void EventHandler::changeMouseCursor(int direction)
 {
-  int cursor = BSPF::clampw(myOSystem.settings().getInt("cursor") + direction, 0, 3);
+  int cursor = BSPF::clampw(myCursorSetting.get() + direction, 0, 3);
 
   myOSystem.settings().setValue("cursor", cursor);
   myOSystem.frameBuffer().setCursorState();
@@ -2998,10 +3019,8 @@ void EventHandler::setState(EventHandlerState state)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void EventHandler::exitEmulation(bool checkLauncher)
 {
-  const string saveOnExit = myOSystem.settings().getString("saveonexit");
-  const bool activeTM = myOSystem.settings().getBool(
-    myOSystem.settings().getBool("dev.settings") ? "dev.timemachine" : "plr.timemachine");
-
+  const string saveOnExit = mySaveOnExitSetting.get();
+  const bool activeTM = timeMachineActive();
 
   if (saveOnExit == "all" && activeTM)
     handleEvent(Event::SaveAllStates);
@@ -3011,7 +3030,7 @@ void EventHandler::exitEmulation(bool checkLauncher)
   if (checkLauncher)
   {
     // Go back to the launcher, or immediately quit
-    if (myOSystem.settings().getBool("exitlauncher") ||
+    if (myExitLauncherSetting.get() ||
         myOSystem.launcherUsed())
       myOSystem.createLauncher();
     else
@@ -3019,6 +3038,13 @@ void EventHandler::exitEmulation(bool checkLauncher)
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool EventHandler::timeMachineActive() const
+{
+  return myDevSettingsSetting.get() ? myDevTimeMachineSetting.get()
+                                    : myPlrTimeMachineSetting.get();
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 EventHandler::EmulActionList EventHandler::ourEmulActionList = { {
   { Event::Quit,                    "Quit",                                  "" },
@@ -3061,6 +3087,7 @@ EventHandler::EmulActionList EventHandler::ourEmulActionList = { {
   { Event::ToggleContSnapshots,     "Save continuous snapsh. (as defined)",  "" },
   { Event::ToggleContSnapshotsFrame,"Save continuous snapsh. (every frame)", "" },
 #endif
+  { Event::ToggleVideoRecording,    "Toggle video recording",                "" },
 
   { Event::JoystickZeroUp,          "P0 Joystick Up",                        "" },
   { Event::JoystickZeroDown,        "P0 Joystick Down",                      "" },
@@ -3311,6 +3338,7 @@ const Event::EventSet EventHandler::MiscEvents = {
   Event::TogglePauseMode, Event::OptionsMenuMode, Event::CmdMenuMode, Event::ExitMode,
   Event::ToggleTurbo, Event::DecreaseSpeed, Event::IncreaseSpeed,
   Event::TakeSnapshot, Event::ToggleContSnapshots, Event::ToggleContSnapshotsFrame,
+  Event::ToggleVideoRecording,
   // Event::MouseAxisXMove, Event::MouseAxisYMove,
   // Event::MouseButtonLeftValue, Event::MouseButtonRightValue,
   Event::HighScoresMenuMode,
@@ -37,6 +37,7 @@ namespace GUI {
 #include "StellaKeys.hxx"
 #include "PKeyboardHandler.hxx"
 #include "PJoystickHandler.hxx"
+#include "Settings.hxx"
 #include "bspf.hxx"
 
 /**
@@ -569,6 +570,9 @@ class EventHandler
     AdjustFunction cycleAdjustSetting(int direction);
     AdjustFunction getAdjustSetting(AdjustSetting setting);
 
+    // Whether the Time Machine of the current (player/developer) settings is on
+    bool timeMachineActive() const;
+
     PhysicalJoystickHandler& joyHandler() { return *myPJoyHandler; }
     PhysicalKeyboardHandler& keyHandler() { return *myPKeyHandler; }
 
@@ -596,6 +600,21 @@ class EventHandler
     // ID of the currently selected direct hotkey setting (0 if none)
     AdjustSetting myAdjustDirect{AdjustSetting::NONE};
 
+    // Handles to the settings checked when cycling through the adjustments
+    Settings::Handle<string> myPaletteSetting;
+    Settings::Handle<int> myTVFilterSetting;
+    Settings::Handle<string> myUseMouseSetting;
+    Settings::Handle<int> myCursorSetting;
+
+    // Handles to the settings checked when exiting or leaving the emulation
+    Settings::Handle<bool> myConfirmExitSetting;
+    Settings::Handle<string> mySaveOnExitSetting;
+    Settings::Handle<bool> myExitLauncherSetting;
+    Settings::Handle<bool> myMinimalUISetting;
+    Settings::Handle<bool> myDevSettingsSetting;
+    Settings::Handle<bool> myPlrTimeMachineSetting;
+    Settings::Handle<bool> myDevTimeMachineSetting;
+
     // Global Event object
     Event myEvent;
 
@@ -644,7 +663,7 @@ class EventHandler
     #else
       REFRESH_SIZE         = 0,
     #endif
-      EMUL_ACTIONLIST_SIZE = 207 + PNG_SIZE + COMBO_SIZE + REFRESH_SIZE,
+      EMUL_ACTIONLIST_SIZE = 208 + PNG_SIZE + COMBO_SIZE + REFRESH_SIZE,
       MENU_ACTIONLIST_SIZE = 18
     ;
 
@@ -334,6 +334,17 @@ class FBSurface
     */
     virtual bool render() = 0;
 
+    /**
+      This method can be called before render() to indicate that only the
+      given rows changed since the last render.  Backends may use this to
+      reduce the amount of data uploaded; otherwise the whole surface is
+      considered as changed.  Repeated calls accumulate.
+
+      @param first  The first changed row
+      @param count  The number of changed rows (may be zero)
+    */
+    virtual void setDirtyRows(uInt32 first, uInt32 count) { }
+
     /**
       This method should be called to reset the surface to empty
       pixels / colour black.
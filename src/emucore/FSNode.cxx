@@ -15,6 +15,8 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include <unordered_map>
+
 #include "FSNodeFactory.hxx"
 #include "FSNode.hxx"
 
@@ -135,6 +137,11 @@ bool FilesystemNode::getChildren(FSList& fslist, ListMode mode,
   if (!_realNode->getChildren(tmp, mode))
     return false;
 
+#if defined(ZIP_SUPPORT)
+  // The ZIP nodes created for sorting, so that each archive is only opened once
+  std::unordered_map<const AbstractFSNode*, AbstractFSNodePtr> zipNodes;
+#endif
+
   // when incuding child directories, everything must be sorted once at the end
   if(!includeChildDirectories)
   {
@@ -148,9 +155,10 @@ bool FilesystemNode::getChildren(FSList& fslist, ListMode mode,
     {
       if(BSPF::endsWithIgnoreCase(i->getPath(), ".zip"))
       {
-        FilesystemNodeZIP node(i->getPath());
-
-        i->setName(node.getName());
+        AbstractFSNodePtr zipNode = FilesystemNodeFactory::create(i->getPath(),
+                                                                  FilesystemNodeFactory::Type::ZIP);
+        i->setName(zipNode->getName());
+        zipNodes.emplace(i.get(), std::move(zipNode));
       }
     }
   #endif
@@ -183,9 +191,10 @@ bool FilesystemNode::getChildren(FSList& fslist, ListMode mode,
   #if defined(ZIP_SUPPORT)
     if (BSPF::endsWithIgnoreCase(i->getPath(), ".zip"))
     {
-      // Force ZIP c'tor to be called
-      AbstractFSNodePtr ptr = FilesystemNodeFactory::create(i->getPath(),
-                                                            FilesystemNodeFactory::Type::ZIP);
+      // Force ZIP c'tor to be called (unless this already happened above)
+      const auto iter = zipNodes.find(i.get());
+      AbstractFSNodePtr ptr = iter != zipNodes.end() ? iter->second :
+          FilesystemNodeFactory::create(i->getPath(), FilesystemNodeFactory::Type::ZIP);
       FilesystemNode zipNode(ptr);
 
       if(filter(zipNode))
@@ -319,6 +328,18 @@ bool FilesystemNode::isWritable() const
   return _realNode ? _realNode->isWritable() : false;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+size_t FilesystemNode::getSize() const
+{
+  return _realNode ? _realNode->getSize() : 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 FilesystemNode::getLastModified() const
+{
+  return _realNode ? _realNode->getLastModified() : 0;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool FilesystemNode::makeDir()
 {
@@ -226,6 +226,22 @@ class FilesystemNode
      */
     bool isWritable() const;
 
+    /**
+     * Get the size of the file referred to by this path.
+     *
+     * @return  The size in bytes, or 0 if the size is unknown or the path
+     *          doesn't refer to a file.
+     */
+    size_t getSize() const;
+
+    /**
+     * Get the time the object referred to by this path was last modified.
+     *
+     * @return  The modification time in seconds since the epoch, or 0 if
+     *          it is unknown.
+     */
+    uInt64 getLastModified() const;
+
     /**
      * Create a directory from the current node path.
      *
@@ -295,6 +311,8 @@ class FilesystemNode
     string getPathWithExt(const string& ext) const;
 
   private:
+    friend class DirectoryScanner;
+
     explicit FilesystemNode(const AbstractFSNodePtr& realNode);
     AbstractFSNodePtr _realNode;
     void setPath(const string& path);
@@ -316,6 +334,7 @@ class AbstractFSNode
 {
   protected:
     friend class FilesystemNode;
+    friend class DirectoryScanner;
     using ListMode = FilesystemNode::ListMode;
     using NameFilter = FilesystemNode::NameFilter;
 
@@ -420,6 +439,21 @@ class AbstractFSNode
      */
     virtual bool isWritable() const = 0;
 
+    /**
+     * Get the size of the file referred to by this path.
+     *
+     * @return  The size in bytes, or 0 if the size is unknown.
+     */
+    virtual size_t getSize() const { return 0; }
+
+    /**
+     * Get the time the object referred to by this path was last modified.
+     *
+     * @return  The modification time in seconds since the epoch, or 0 if
+     *          it is unknown.
+     */
+    virtual uInt64 getLastModified() const { return 0; }
+
     /**
      * Create a directory from the current node path.
      *
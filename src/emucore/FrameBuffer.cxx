@@ -56,11 +56,17 @@
   #include "HighScoresMenu.hxx"
   #include "MessageMenu.hxx"
   #include "TimeMachine.hxx"
+  #include "VideoRecorder.hxx"
 #endif
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 FrameBuffer::FrameBuffer(OSystem& osystem)
-  : myOSystem{osystem}
+  : myOSystem{osystem},
+    myPauseDimSetting{osystem.settings().handle<bool>("pausedim")},
+    myUIMessagesSetting{osystem.settings().handle<bool>("uimessages")},
+    myTurboSetting{osystem.settings().handle<bool>("turbo")},
+    mySpeedSetting{osystem.settings().handle<float>("speed")},
+    myDevSettingsSetting{osystem.settings().handle<bool>("dev.settings")}
 {
 }
 
@@ -338,7 +344,7 @@ void FrameBuffer::update(UpdateMode mode)
     case EventHandlerState::PAUSE:
     {
       // Show a pause message immediately and then every 7 seconds
-      bool shade = myOSystem.settings().getBool("pausedim");
+      const bool shade = myPauseDimSetting.get();
 
       if(myPausedCount-- <= 0)
       {
@@ -552,7 +558,7 @@ void FrameBuffer::updateInEmulationMode(float framesPerSecond)
 void FrameBuffer::createMessage(const string& message, MessagePosition position, bool force)
 {
   // Only show messages if they've been enabled
-  if(myMsg.surface == nullptr || !(force || myOSystem.settings().getBool("uimessages")))
+  if(myMsg.surface == nullptr || !(force || myUIMessagesSetting.get()))
     return;
 
   const int fontHeight = font().getFontHeight();
@@ -656,13 +662,13 @@ void FrameBuffer::drawFrameStats(float framesPerSecond)
   yPos += dy;
   ss.str("");
 
+  if(myTurboSetting.changed() || mySpeedSetting.changed())
+    mySpeedPercent = 100 * (myTurboSetting.get() ? 20.0F : mySpeedSetting.get());
+
   ss
     << std::fixed << std::setprecision(1) << framesPerSecond
     << "fps @ "
-    << std::fixed << std::setprecision(0) << 100 *
-      (myOSystem.settings().getBool("turbo")
-        ? 20.0F
-        : myOSystem.settings().getFloat("speed"))
+    << std::fixed << std::setprecision(0) << mySpeedPercent
     << "% speed";
 
   myStatsMsg.surface->drawString(f, ss.str(), xPos, yPos,
@@ -672,7 +678,7 @@ void FrameBuffer::drawFrameStats(float framesPerSecond)
   ss.str("");
 
   ss << info.BankSwitch;
-  if (myOSystem.settings().getBool("dev.settings")) ss << "| Developer";
+  if (myDevSettingsSetting.get()) ss << "| Developer";
 
   myStatsMsg.surface->drawString(f, ss.str(), xPos, yPos,
       myStatsMsg.w, myStatsMsg.color, TextAlign::Left, 0, true, kBGColor);
@@ -690,7 +696,7 @@ void FrameBuffer::toggleFrameStats(bool toggle)
   if (toggle)
     showFrameStats(!myStatsEnabled);
   myOSystem.settings().setValue(
-    myOSystem.settings().getBool("dev.settings") ? "dev.stats" : "plr.stats", myStatsEnabled);
+    myDevSettingsSetting.get() ? "dev.stats" : "plr.stats", myStatsEnabled);
 
   myOSystem.frameBuffer().showTextMessage(string("Console info ") +
                                           (myStatsEnabled ? "enabled" : "disabled"));
@@ -943,6 +949,11 @@ void FrameBuffer::setTIAPalette(const PaletteArray& rgb_palette)
   // Let the TIA surface know about the new palette
   myTIASurface->setPalette(tia_palette, rgb_palette);
 
+#ifdef GUI_SUPPORT
+  // Recordings store the raw palette along with the color indices
+  myOSystem.videoRecorder().setPalette(rgb_palette);
+#endif
+
   // Since the UI palette shares the TIA palette, we need to update it too
   setUIPalette();
 }
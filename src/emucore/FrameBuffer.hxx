@@ -22,7 +22,6 @@
 
 class OSystem;
 class Console;
-class Settings;
 class FBSurface;
 class TIASurface;
 
@@ -32,6 +31,7 @@ class TIASurface;
 
 #include "Rect.hxx"
 #include "Variant.hxx"
+#include "Settings.hxx"
 #include "TIAConstants.hxx"
 #include "FBBackend.hxx"
 #include "FrameBufferConstants.hxx"
@@ -522,6 +522,15 @@ class FrameBuffer
     bool myStatsEnabled{false};
     uInt32 myLastScanlines{0};
 
+    // Handles to the settings read while drawing each frame; the speed
+    // shown in the frame stats is only calculated again once changed
+    Settings::Handle<bool> myPauseDimSetting;
+    Settings::Handle<bool> myUIMessagesSetting;
+    Settings::Handle<bool> myTurboSetting;
+    Settings::Handle<float> mySpeedSetting;
+    Settings::Handle<bool> myDevSettingsSetting;
+    float mySpeedPercent{100.F};
+
     bool myGrabMouse{false};
     bool myHiDPIAllowed{false};
     bool myHiDPIEnabled{false};
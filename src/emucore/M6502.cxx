@@ -47,7 +47,12 @@
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 M6502::M6502(const Settings& settings)
-  : mySettings{settings}
+  : myDevSettingsHandle{settings.handle<bool>("dev.settings")},
+    myDevCpuRandomHandle{settings.handle<string>("dev.cpurandom")},
+    myPlrCpuRandomHandle{settings.handle<string>("plr.cpurandom")},
+    myGhostReadsTrapHandle{settings.handle<bool>("dbg.ghostreadstrap")},
+    myRWPortBreakHandle{settings.handle<bool>("dev.rwportbreak")},
+    myWRPortBreakHandle{settings.handle<bool>("dev.wrportbreak")}
 {
 }
 
@@ -65,8 +70,9 @@ void M6502::reset()
   myExecutionStatus = 0;
 
   // Set registers to random or default values
-  bool devSettings = mySettings.getBool("dev.settings");
-  const string& cpurandom = mySettings.getString(devSettings ? "dev.cpurandom" : "plr.cpurandom");
+  const bool devSettings = myDevSettingsHandle.get();
+  const string& cpurandom = devSettings ? myDevCpuRandomHandle.get()
+                                        : myPlrCpuRandomHandle.get();
   SP = BSPF::containsIgnoreCase(cpurandom, "S") ?
           mySystem->randGenerator().next() : 0xfd;
   A  = BSPF::containsIgnoreCase(cpurandom, "A") ?
@@ -90,9 +96,9 @@ void M6502::reset()
   myFlags = DISASM_NONE;
 
   myHaltRequested = false;
-  myGhostReadsTrap = mySettings.getBool("dbg.ghostreadstrap");
-  myReadFromWritePortBreak = devSettings ? mySettings.getBool("dev.rwportbreak") : false;
-  myWriteToReadPortBreak = devSettings ? mySettings.getBool("dev.wrportbreak") : false;
+  myGhostReadsTrap = myGhostReadsTrapHandle.get();
+  myReadFromWritePortBreak = devSettings ? myRWPortBreakHandle.get() : false;
+  myWriteToReadPortBreak = devSettings ? myWRPortBreakHandle.get() : false;
 
   myLastBreakCycle = ULLONG_MAX;
 }
@@ -175,13 +181,29 @@ void M6502::requestHalt()
 {
   if (!myOnHaltCallback) throw runtime_error("onHaltCallback not configured");
   myHaltRequested = true;
+#ifdef DEBUGGER_SUPPORT
+  // The halt cycles are added to the instruction which requested the halt
+  myHaltPC = myProfilePC;
+  myHaltBank = myProfileBank;
+#endif
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 inline void M6502::handleHalt()
 {
   if (myHaltRequested) {
-    myOnHaltCallback();
+  #ifdef DEBUGGER_SUPPORT
+    if(myCycleProfiler.isEnabled())
+    {
+      const uInt64 haltStart = mySystem->cycles();
+
+      myOnHaltCallback();
+      myCycleProfiler.addHalt(myHaltPC, myHaltBank,
+                              uInt32(mySystem->cycles() - haltStart));
+    }
+    else
+  #endif
+      myOnHaltCallback();
     myHaltRequested = false;
   }
 }
@@ -306,6 +328,12 @@ inline void M6502::_execute(uInt64 cycles, DispatchResult& result)
         icycles = 0;
     #ifdef DEBUGGER_SUPPORT
         uInt16 oldPC = PC;
+
+        if(myCycleProfiler.isEnabled())
+        {
+          myProfilePC = oldPC;
+          myProfileBank = mySystem->cart().getBank(oldPC);
+        }
     #endif
 
         // Fetch instruction at the program counter
@@ -322,6 +350,9 @@ inline void M6502::_execute(uInt64 cycles, DispatchResult& result)
         }
 
     #ifdef DEBUGGER_SUPPORT
+        if(myCycleProfiler.isEnabled())
+          myCycleProfiler.add(myProfilePC, myProfileBank, icycles);
+
         if(myReadFromWritePortBreak)
         {
           uInt16 rwpAddr = mySystem->cart().getIllegalRAMReadAccess();
@@ -20,7 +20,6 @@
 
 #include <functional>
 
-class Settings;
 class System;
 class DispatchResult;
 
@@ -31,11 +30,13 @@ class DispatchResult;
   #include "Expression.hxx"
   #include "TrapArray.hxx"
   #include "BreakpointMap.hxx"
+  #include "CycleProfiler.hxx"
 #endif
 
 #include "bspf.hxx"
 #include "Device.hxx"
 #include "Serializable.hxx"
+#include "Settings.hxx"
 
 /**
   The 6502 is an 8-bit microprocessor that has a 64K addressing space.
@@ -234,6 +235,8 @@ class M6502 : public Serializable
 
     BreakpointMap& breakPoints() { return myBreakPoints; }
 
+    CycleProfiler& cycleProfiler() { return myCycleProfiler; }
+
     // methods for 'breakif' handling
     uInt32 addCondBreak(Expression* e, const string& name, bool oneShot = false);
     bool delCondBreak(uInt32 idx);
@@ -356,8 +359,13 @@ class M6502 : public Serializable
     /// Pointer to the system the processor is installed in or the null pointer
     System* mySystem{nullptr};
 
-    /// Reference to the settings
-    const Settings& mySettings;
+    /// Handles to the settings applied on each reset
+    Settings::Handle<bool> myDevSettingsHandle;
+    Settings::Handle<string> myDevCpuRandomHandle;
+    Settings::Handle<string> myPlrCpuRandomHandle;
+    Settings::Handle<bool> myGhostReadsTrapHandle;
+    Settings::Handle<bool> myRWPortBreakHandle;
+    Settings::Handle<bool> myWRPortBreakHandle;
 
     uInt8 A{0};    // Accumulator
     uInt8 X{0};    // X index register
@@ -457,6 +465,11 @@ class M6502 : public Serializable
     HitTrapInfo myHitTrapInfo;
 
     BreakpointMap myBreakPoints;
+
+    // Cycles spent per instruction, and the instruction which requested a halt
+    CycleProfiler myCycleProfiler;
+    uInt16 myProfilePC{0}, myProfileBank{0};
+    uInt16 myHaltPC{0}, myHaltBank{0};
     vector<unique_ptr<Expression>> myCondBreaks;
     StringList myCondBreakNames;
     vector<unique_ptr<Expression>> myCondSaveStates;
@@ -75,12 +75,17 @@ struct MD5_CTX
 #define S43 15
 #define S44 21
 
+// Number of messages hashed at once by MD5TransformLanes
+static constexpr uInt32 LANES = 4;
+
 static void MD5Init(MD5_CTX*);
 static void MD5Update(MD5_CTX*, const uInt8*, uInt32);
 static void MD5Final(uInt8[16], MD5_CTX*);
 static void MD5Transform(uInt32 [4], const uInt8 [64]);
+static void MD5TransformLanes(uInt32 [4][LANES], const uInt8* [LANES]);
 static void Encode(uInt8*, uInt32*, uInt32);
 static void Decode(uInt32*, const uInt8*, uInt32);
+static string toHex(const uInt8[16]);
 
 static uInt8 PADDING[64] = {
   0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -120,6 +125,16 @@ static uInt8 PADDING[64] = {
  (a) += (b); \
   }
 
+// The same transformations, for all lanes of MD5TransformLanes.
+#define FF4(a, b, c, d, x, s, ac) \
+  for (uInt32 l = 0; l < LANES; ++l) FF ((a)[l], (b)[l], (c)[l], (d)[l], (x)[l], s, ac)
+#define GG4(a, b, c, d, x, s, ac) \
+  for (uInt32 l = 0; l < LANES; ++l) GG ((a)[l], (b)[l], (c)[l], (d)[l], (x)[l], s, ac)
+#define HH4(a, b, c, d, x, s, ac) \
+  for (uInt32 l = 0; l < LANES; ++l) HH ((a)[l], (b)[l], (c)[l], (d)[l], (x)[l], s, ac)
+#define II4(a, b, c, d, x, s, ac) \
+  for (uInt32 l = 0; l < LANES; ++l) II ((a)[l], (b)[l], (c)[l], (d)[l], (x)[l], s, ac)
+
 // MD5 initialization. Begins an MD5 operation, writing a new context.
 static void MD5Init(MD5_CTX* context)
 {
@@ -281,6 +296,104 @@ static void MD5Transform(uInt32 state[4], const uInt8 block[64])
   memset (reinterpret_cast<POINTER>(x), 0, sizeof(x));
 }
 
+// MD5 basic transformation of one block of several messages at once.
+// Each lane works like MD5Transform; as all lanes do the same operations,
+// the loops over the lanes can be vectorized.
+static void MD5TransformLanes(uInt32 state[4][LANES], const uInt8* block[LANES])
+{
+  uInt32 a[LANES], b[LANES], c[LANES], d[LANES], x[16][LANES];
+
+  for (uInt32 l = 0; l < LANES; ++l) {
+    for (uInt32 i = 0, j = 0; i < 16; ++i, j += 4)
+      x[i][l] = (uInt32(block[l][j])) | ((uInt32(block[l][j+1])) << 8) |
+      ((uInt32(block[l][j+2])) << 16) | ((uInt32(block[l][j+3])) << 24);
+
+    a[l] = state[0][l];
+    b[l] = state[1][l];
+    c[l] = state[2][l];
+    d[l] = state[3][l];
+  }
+
+  /* Round 1 */
+  FF4 (a, b, c, d, x[ 0], S11, 0xd76aa478); /* 1 */
+  FF4 (d, a, b, c, x[ 1], S12, 0xe8c7b756); /* 2 */
+  FF4 (c, d, a, b, x[ 2], S13, 0x242070db); /* 3 */
+  FF4 (b, c, d, a, x[ 3], S14, 0xc1bdceee); /* 4 */
+  FF4 (a, b, c, d, x[ 4], S11, 0xf57c0faf); /* 5 */
+  FF4 (d, a, b, c, x[ 5], S12, 0x4787c62a); /* 6 */
+  FF4 (c, d, a, b, x[ 6], S13, 0xa8304613); /* 7 */
+  FF4 (b, c, d, a, x[ 7], S14, 0xfd469501); /* 8 */
+  FF4 (a, b, c, d, x[ 8], S11, 0x698098d8); /* 9 */
+  FF4 (d, a, b, c, x[ 9], S12, 0x8b44f7af); /* 10 */
+  FF4 (c, d, a, b, x[10], S13, 0xffff5bb1); /* 11 */
+  FF4 (b, c, d, a, x[11], S14, 0x895cd7be); /* 12 */
+  FF4 (a, b, c, d, x[12], S11, 0x6b901122); /* 13 */
+  FF4 (d, a, b, c, x[13], S12, 0xfd987193); /* 14 */
+  FF4 (c, d, a, b, x[14], S13, 0xa679438e); /* 15 */
+  FF4 (b, c, d, a, x[15], S14, 0x49b40821); /* 16 */
+
+  /* Round 2 */
+  GG4 (a, b, c, d, x[ 1], S21, 0xf61e2562); /* 17 */
+  GG4 (d, a, b, c, x[ 6], S22, 0xc040b340); /* 18 */
+  GG4 (c, d, a, b, x[11], S23, 0x265e5a51); /* 19 */
+  GG4 (b, c, d, a, x[ 0], S24, 0xe9b6c7aa); /* 20 */
+  GG4 (a, b, c, d, x[ 5], S21, 0xd62f105d); /* 21 */
+  GG4 (d, a, b, c, x[10], S22,  0x2441453); /* 22 */
+  GG4 (c, d, a, b, x[15], S23, 0xd8a1e681); /* 23 */
+  GG4 (b, c, d, a, x[ 4], S24, 0xe7d3fbc8); /* 24 */
+  GG4 (a, b, c, d, x[ 9], S21, 0x21e1cde6); /* 25 */
+  GG4 (d, a, b, c, x[14], S22, 0xc33707d6); /* 26 */
+  GG4 (c, d, a, b, x[ 3], S23, 0xf4d50d87); /* 27 */
+  GG4 (b, c, d, a, x[ 8], S24, 0x455a14ed); /* 28 */
+  GG4 (a, b, c, d, x[13], S21, 0xa9e3e905); /* 29 */
+  GG4 (d, a, b, c, x[ 2], S22, 0xfcefa3f8); /* 30 */
+  GG4 (c, d, a, b, x[ 7], S23, 0x676f02d9); /* 31 */
+  GG4 (b, c, d, a, x[12], S24, 0x8d2a4c8a); /* 32 */
+
+  /* Round 3 */
+  HH4 (a, b, c, d, x[ 5], S31, 0xfffa3942); /* 33 */
+  HH4 (d, a, b, c, x[ 8], S32, 0x8771f681); /* 34 */
+  HH4 (c, d, a, b, x[11], S33, 0x6d9d6122); /* 35 */
+  HH4 (b, c, d, a, x[14], S34, 0xfde5380c); /* 36 */
+  HH4 (a, b, c, d, x[ 1], S31, 0xa4beea44); /* 37 */
+  HH4 (d, a, b, c, x[ 4], S32, 0x4bdecfa9); /* 38 */
+  HH4 (c, d, a, b, x[ 7], S33, 0xf6bb4b60); /* 39 */
+  HH4 (b, c, d, a, x[10], S34, 0xbebfbc70); /* 40 */
+  HH4 (a, b, c, d, x[13], S31, 0x289b7ec6); /* 41 */
+  HH4 (d, a, b, c, x[ 0], S32, 0xeaa127fa); /* 42 */
+  HH4 (c, d, a, b, x[ 3], S33, 0xd4ef3085); /* 43 */
+  HH4 (b, c, d, a, x[ 6], S34,  0x4881d05); /* 44 */
+  HH4 (a, b, c, d, x[ 9], S31, 0xd9d4d039); /* 45 */
+  HH4 (d, a, b, c, x[12], S32, 0xe6db99e5); /* 46 */
+  HH4 (c, d, a, b, x[15], S33, 0x1fa27cf8); /* 47 */
+  HH4 (b, c, d, a, x[ 2], S34, 0xc4ac5665); /* 48 */
+
+  /* Round 4 */
+  II4 (a, b, c, d, x[ 0], S41, 0xf4292244); /* 49 */
+  II4 (d, a, b, c, x[ 7], S42, 0x432aff97); /* 50 */
+  II4 (c, d, a, b, x[14], S43, 0xab9423a7); /* 51 */
+  II4 (b, c, d, a, x[ 5], S44, 0xfc93a039); /* 52 */
+  II4 (a, b, c, d, x[12], S41, 0x655b59c3); /* 53 */
+  II4 (d, a, b, c, x[ 3], S42, 0x8f0ccc92); /* 54 */
+  II4 (c, d, a, b, x[10], S43, 0xffeff47d); /* 55 */
+  II4 (b, c, d, a, x[ 1], S44, 0x85845dd1); /* 56 */
+  II4 (a, b, c, d, x[ 8], S41, 0x6fa87e4f); /* 57 */
+  II4 (d, a, b, c, x[15], S42, 0xfe2ce6e0); /* 58 */
+  II4 (c, d, a, b, x[ 6], S43, 0xa3014314); /* 59 */
+  II4 (b, c, d, a, x[13], S44, 0x4e0811a1); /* 60 */
+  II4 (a, b, c, d, x[ 4], S41, 0xf7537e82); /* 61 */
+  II4 (d, a, b, c, x[11], S42, 0xbd3af235); /* 62 */
+  II4 (c, d, a, b, x[ 2], S43, 0x2ad7d2bb); /* 63 */
+  II4 (b, c, d, a, x[ 9], S44, 0xeb86d391); /* 64 */
+
+  for (uInt32 l = 0; l < LANES; ++l) {
+    state[0][l] += a[l];
+    state[1][l] += b[l];
+    state[2][l] += c[l];
+    state[3][l] += d[l];
+  }
+}
+
 // Encodes input (uInt32) into output (uInt8). Assumes len is
 // a multiple of 4.
 static void Encode(uInt8* output, uInt32* input, uInt32 len)
@@ -295,6 +408,20 @@ static void Encode(uInt8* output, uInt32* input, uInt32 len)
   }
 }
 
+// Converts a digest into 32 hexadecimal digits.
+static string toHex(const uInt8 digest[16])
+{
+  static constexpr char hex[] = "0123456789abcdef";
+  string result;
+
+  for (int t = 0; t < 16; ++t) {
+    result += hex[(digest[t] >> 4) & 0x0f];
+    result += hex[digest[t] & 0x0f];
+  }
+
+  return result;
+}
+
 // Decodes input (uInt8) into output (uInt32). Assumes len is
 // a multiple of 4.
 static void Decode(uInt32* output, const uInt8* input, uInt32 len)
@@ -322,7 +449,6 @@ string hash(const ByteBuffer& buffer, size_t length)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 string hash(const uInt8* buffer, size_t length)
 {
-  char hex[] = "0123456789abcdef";
   MD5_CTX context;
   uInt8 md5[16];
   uInt32 len32 = static_cast<uInt32>(length);  // Always use 32-bit for now
@@ -331,11 +457,123 @@ string hash(const uInt8* buffer, size_t length)
   MD5Update(&context, buffer, len32);
   MD5Final(md5, &context);
 
-  string result;
-  for(int t = 0; t < 16; ++t)
+  return toHex(md5);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// The padded blocks of one message, and its state while being hashed
+struct Lane
+{
+  uInt32 message{0};      // index of the message
+  const uInt8* data{nullptr};
+  uInt32 dataBlocks{0};   // number of complete blocks in the message
+  uInt32 numBlocks{0};    // including the padding blocks
+  uInt32 nextBlock{0};
+  uInt8 padding[128];     // the remaining bytes, padding and length
+  uInt32 state[4];
+
+  void start(uInt32 index, const uInt8* buffer, size_t length)
+  {
+    uInt32 len32 = static_cast<uInt32>(length);  // Always use 32-bit for now
+    uInt32 rest = len32 & 0x3f;
+
+    message = index;
+    data = buffer;
+    dataBlocks = len32 >> 6;
+    numBlocks = dataBlocks + (rest < 56 ? 1 : 2);
+    nextBlock = 0;
+
+    // Pad out to 56 mod 64, and append the length in bits
+    memset(padding, 0, sizeof(padding));
+    if(rest > 0)
+      memcpy(padding, &buffer[dataBlocks << 6], rest);
+    padding[rest] = 0x80;
+    uInt32 bits[2] = { len32 << 3, len32 >> 29 };
+    Encode(&padding[((numBlocks - dataBlocks) << 6) - 8], bits, 8);
+
+    state[0] = 0x67452301;
+    state[1] = 0xefcdab89;
+    state[2] = 0x98badcfe;
+    state[3] = 0x10325476;
+  }
+
+  bool active() const { return nextBlock < numBlocks; }
+
+  const uInt8* block() const
+  {
+    return nextBlock < dataBlocks ? &data[nextBlock << 6]
+                                  : &padding[(nextBlock - dataBlocks) << 6];
+  }
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+StringList hash(const std::vector<ByteBuffer>& buffers,
+                const std::vector<size_t>& lengths)
+{
+  StringList result(buffers.size());
+  std::array<Lane, LANES> lanes;
+  uInt32 next = 0;
+  uInt8 md5[16];
+
+  while(true)
   {
-    result += hex[(md5[t] >> 4) & 0x0f];
-    result += hex[md5[t] & 0x0f];
+    // Start the next messages in the lanes which are done
+    uInt32 active = 0;
+    for(auto& lane: lanes)
+    {
+      if(!lane.active() && next < buffers.size())
+      {
+        lane.start(next, buffers[next].get(), lengths[next]);
+        ++next;
+      }
+      if(lane.active())
+        ++active;
+    }
+    if(active == 0)
+      break;
+
+    if(active == 1)
+    {
+      // A single message is faster to hash on its own
+      for(auto& lane: lanes)
+        for(; lane.active(); ++lane.nextBlock)
+          MD5Transform(lane.state, lane.block());
+    }
+    else
+    {
+      // Hash the next block of all messages; idle lanes hash anything
+      uInt32 state[4][LANES];
+      const uInt8* block[LANES];
+      for(uInt32 l = 0; l < LANES; ++l)
+      {
+        for(uInt32 i = 0; i < 4; ++i)
+          state[i][l] = lanes[l].state[i];
+        block[l] = lanes[l].active() ? lanes[l].block() : PADDING;
+      }
+
+      MD5TransformLanes(state, block);
+
+      for(uInt32 l = 0; l < LANES; ++l)
+      {
+        if(lanes[l].active())
+        {
+          for(uInt32 i = 0; i < 4; ++i)
+            lanes[l].state[i] = state[i][l];
+          ++lanes[l].nextBlock;
+        }
+      }
+    }
+
+    // Store the digests of the finished messages
+    for(auto& lane: lanes)
+    {
+      if(!lane.active() && lane.numBlocks != 0)
+      {
+        Encode(md5, lane.state, 16);
+        result[lane.message] = toHex(md5);
+        lane.numBlocks = lane.nextBlock = 0;
+      }
+    }
   }
 
   return result;
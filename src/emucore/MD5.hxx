@@ -47,6 +47,18 @@ namespace MD5 {
   */
   string hash(const string& buffer);
 
+  /**
+    Get the MD5 Message-Digests of several messages.  The messages are
+    hashed in parallel lanes (which the compiler can map to SIMD
+    instructions), so this is faster than hashing them one by one.
+
+    @param buffers The messages to compute the digests of
+    @param lengths The lengths of the messages
+    @return The message-digests, in the order of the messages
+  */
+  StringList hash(const std::vector<ByteBuffer>& buffers,
+                  const std::vector<size_t>& lengths);
+
   /**
     Get the MD5 Message-Digest of the file contained in 'node'.
     The digest consists of 32 hexadecimal digits.
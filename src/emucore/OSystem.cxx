@@ -49,6 +49,7 @@
 #include "TIAConstants.hxx"
 #include "Settings.hxx"
 #include "PropsSet.hxx"
+#include "AutodetectCache.hxx"
 #include "EventHandler.hxx"
 #include "PNGLibrary.hxx"
 #include "Console.hxx"
@@ -57,6 +58,7 @@
 #include "TimerManager.hxx"
 #ifdef GUI_SUPPORT
 #include "HighScoresManager.hxx"
+#include "VideoRecorder.hxx"
 #endif
 #include "Version.hxx"
 #include "TIA.hxx"
@@ -103,6 +105,7 @@ OSystem::OSystem()
   mySettings = MediaFactory::createSettings();
 
   myPropSet = make_unique<PropertiesSet>();
+  myAutodetectCache = make_unique<AutodetectCache>();
 
   Logger::instance().setLogParameters(Logger::Level::MAX, false);
 }
@@ -180,6 +183,7 @@ bool OSystem::initialize(const Settings::Options& options)
   myHighScoresMenu = make_unique<HighScoresMenu>(*this);
   myMessageMenu = make_unique<MessageMenu>(*this);
   myTimeMachine = make_unique<TimeMachine>(*this);
+  myVideoRecorder = make_unique<VideoRecorder>(*this);
   myLauncher = make_unique<Launcher>(*this);
 
   myHighScoresManager->setRepository(getHighscoreRepository());
@@ -224,6 +228,7 @@ void OSystem::loadConfig(const Settings::Options& options)
 
   mySettings->setRepository(getSettingsRepository());
   myPropSet->setRepository(getPropertyRepository());
+  myAutodetectCache->setRepository(getAutodetectRepository());
 
   mySettings->load(options);
 
@@ -607,7 +612,8 @@ unique_ptr<Console> OSystem::openConsole(const FilesystemNode& romfile, string&
     string cartmd5 = md5;
     const string& type = props.get(PropType::Cart_Type);
     unique_ptr<Cartridge> cart =
-      CartCreator::create(romfile, image, size, cartmd5, type, *mySettings);
+      CartCreator::create(romfile, image, size, cartmd5, type, *mySettings,
+                          myAutodetectCache.get());
 
     // Some properties may not have a name set; we can't leave it blank
     if(props.get(PropType::Cart_Name) == EmptyString)
@@ -675,6 +681,10 @@ void OSystem::closeConsole()
   #ifdef CHEATCODE_SUPPORT
     // If a previous console existed, save cheats before creating a new one
     myCheatManager->saveCheats(myConsole->properties().get(PropType::Cart_MD5));
+  #endif
+  #ifdef GUI_SUPPORT
+    // A recording always ends with its console
+    myVideoRecorder->stop();
   #endif
     myConsole.reset();
   }
@@ -18,6 +18,7 @@
 #ifndef OSYSTEM_HXX
 #define OSYSTEM_HXX
 
+class AutodetectCache;
 class Console;
 class FrameBuffer;
 class EventHandler;
@@ -44,6 +45,7 @@ class AudioSettings;
   class MessageMenu;
   class TimeMachine;
   class VideoAudioDialog;
+  class VideoRecorder;
 #endif
 #ifdef PNG_SUPPORT
   class PNGLibrary;
@@ -132,6 +134,13 @@ class OSystem
     */
     PropertiesSet& propSet() const { return *myPropSet; }
 
+    /**
+      Get the cache of autodetection results for the system.
+
+      @return The autodetection cache object
+    */
+    AutodetectCache& autodetectCache() const { return *myAutodetectCache; }
+
     /**
       Get the console of the system.  The console won't always exist,
       so we should test if it's available.
@@ -238,6 +247,13 @@ class OSystem
       @return The time machine object
     */
     TimeMachine& timeMachine() const { return *myTimeMachine; }
+
+    /**
+      Get the video recorder of the system.
+
+      @return The video recorder object
+    */
+    VideoRecorder& videoRecorder() const { return *myVideoRecorder; }
   #endif
 
   #ifdef PNG_SUPPORT
@@ -445,6 +461,10 @@ class OSystem
 
     virtual shared_ptr<CompositeKeyValueRepositoryAtomic> getHighscoreRepository() = 0;
 
+    virtual shared_ptr<CompositeKeyValueRepositoryAtomic> getAutodetectRepository() = 0;
+
+    virtual shared_ptr<KeyValueRepositoryAtomic> getRomIndexRepository() = 0;
+
   protected:
 
     //////////////////////////////////////////////////////////////////////
@@ -490,6 +510,9 @@ class OSystem
     // Pointer to the PropertiesSet object
     unique_ptr<PropertiesSet> myPropSet;
 
+    // Pointer to the cache of autodetection results
+    unique_ptr<AutodetectCache> myAutodetectCache;
+
     // Pointer to the (currently defined) Console object
     unique_ptr<Console> myConsole;
 
@@ -524,6 +547,9 @@ class OSystem
 
     // Pointer to the TimeMachine object
     unique_ptr<TimeMachine> myTimeMachine;
+
+    // Pointer to the VideoRecorder object
+    unique_ptr<VideoRecorder> myVideoRecorder;
   #endif
 
   #ifdef PNG_SUPPORT
@@ -48,3 +48,15 @@ shared_ptr<CompositeKeyValueRepositoryAtomic> OSystemStandalone::getHighscoreRep
 {
   return shared_ptr<CompositeKeyValueRepositoryAtomic>(myStellaDb, &myStellaDb->highscoreRepository());
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<CompositeKeyValueRepositoryAtomic> OSystemStandalone::getAutodetectRepository()
+{
+  return shared_ptr<CompositeKeyValueRepositoryAtomic>(myStellaDb, &myStellaDb->autodetectRepository());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<KeyValueRepositoryAtomic> OSystemStandalone::getRomIndexRepository()
+{
+  return shared_ptr<KeyValueRepositoryAtomic>(myStellaDb, &myStellaDb->romIndexRepository());
+}
@@ -34,6 +34,10 @@ class OSystemStandalone : public OSystem
 
     shared_ptr<CompositeKeyValueRepositoryAtomic> getHighscoreRepository() override;
 
+    shared_ptr<CompositeKeyValueRepositoryAtomic> getAutodetectRepository() override;
+
+    shared_ptr<KeyValueRepositoryAtomic> getRomIndexRepository() override;
+
   protected:
 
     void initPersistence(FilesystemNode& basedir) override;
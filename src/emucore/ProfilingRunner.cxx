@@ -36,6 +36,7 @@
 #include "Joystick.hxx"
 #include "Random.hxx"
 #include "DispatchResult.hxx"
+#include "Thumbulator.hxx"
 
 using namespace std::chrono;
 
@@ -56,12 +57,18 @@ namespace {
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 ProfilingRunner::ProfilingRunner(int argc, char* argv[])
-  : profilingRuns{std::max<size_t>(argc - 2, 0)}
 {
   for (int i = 2; i < argc; i++) {
-    ProfilingRun& run(profilingRuns[i-2]);
-
     string arg = argv[i];
+
+    // Profile the ARM code of Harmony/Melody carts
+    if (arg == "-armprofile") {
+      myProfileArm = true;
+      continue;
+    }
+
+    profilingRuns.emplace_back();
+    ProfilingRun& run(profilingRuns.back());
     size_t splitPoint = arg.find_first_of(':');
 
     run.romFile = splitPoint == string::npos ? arg : arg.substr(0, splitPoint);
@@ -134,12 +141,19 @@ bool ProfilingRunner::runOne(const ProfilingRun& run)
   cartridge->setStartBankFromPropsFunc([]() { return -1; });
   system.initialize();
 
+  ThumbulatorProfiler* armProfiler = nullptr;
+  if (myProfileArm && cartridge->thumbulator()) {
+    cartridge->thumbulator()->enableProfiling(true);
+    armProfiler = cartridge->thumbulator()->profiler();
+  }
+
   FrameLayoutDetector frameLayoutDetector;
   tia.setFrameManager(&frameLayoutDetector);
   system.reset();
 
   (cout << "detecting frame layout... ").flush();
-  for(int i = 0; i < 60; ++i) tia.update();
+  for(int i = 0; i < 60 && frameLayoutDetector.confidence() < 100; ++i)
+    tia.update();
 
   FrameLayout frameLayout = frameLayoutDetector.detectedLayout();
   ConsoleTiming consoleTiming = ConsoleTiming::ntsc;
@@ -163,6 +177,12 @@ bool ProfilingRunner::runOne(const ProfilingRun& run)
   tia.setLayout(frameLayout);
 
   system.reset();
+  if (armProfiler) {
+    armProfiler->reset();
+    if (armProfiler->loadSymbolsFor(imageFile) == 0)
+      cout << "no ARM symbols found (" << imageFile.getPathWithExt(".elf") << ", "
+           << imageFile.getPathWithExt(".map") << ")" << endl;
+  }
 
   EmulationTiming emulationTiming(frameLayout, consoleTiming);
   uInt64 cycles = 0;
@@ -198,5 +218,7 @@ bool ProfilingRunner::runOne(const ProfilingRun& run)
   (cout << "100%" << endl).flush();
   cout << "real time: " << realtimeUsed << " seconds" << endl;
 
+  if (armProfiler) cout << endl << armProfiler->toString(20);
+
   return true;
 }
@@ -60,6 +60,8 @@ class ProfilingRunner {
     Settings mySettings;
 
     Properties myProps;
+
+    bool myProfileArm{false};
 };
 
 #endif // PROFILING_RUNNER
@@ -69,35 +69,63 @@ bool PropertiesSet::getMD5(const string& md5, Properties& properties,
     }
   }
 
-  // Otherwise, search the internal database using binary search
+  // Otherwise, search the internal database
   if(!found)
   {
-    int low = 0, high = DEF_PROPS_SIZE - 1;
-    while(low <= high)
+    uInt32 index = 0;
+    if(findBuiltIn(md5, index))
     {
-      int i = (low + high) / 2;
-      int cmp = BSPF::compareIgnoreCase(md5,
-          DefProps[i][static_cast<uInt8>(PropType::Cart_MD5)]);
-
-      if(cmp == 0)  // found it
-      {
-        for(uInt8 p = 0; p < static_cast<uInt8>(PropType::NumTypes); ++p)
-          if(DefProps[i][p][0] != 0)
-            properties.set(PropType(p), DefProps[i][p]);
-
-        found = true;
-        break;
-      }
-      else if(cmp < 0)
-        high = i - 1; // look at lower range
-      else
-        low = i + 1;  // look at upper range
+      loadBuiltIn(index, properties);
+      found = true;
     }
   }
 
   return found;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool PropertiesSet::findBuiltIn(const string& md5, uInt32& index)
+{
+  if(md5.length() != 32)
+    return false;
+
+  // Convert the md5 into four 32-bit words (as used by DefPropsMD5)
+  std::array<uInt32, 4> words{0};
+  for(uInt32 i = 0; i < 32; ++i)
+  {
+    const char c = md5[i];
+    uInt32 nibble = 0;
+    if(c >= '0' && c <= '9')       nibble = c - '0';
+    else if(c >= 'a' && c <= 'f')  nibble = c - 'a' + 10;
+    else if(c >= 'A' && c <= 'F')  nibble = c - 'A' + 10;
+    else                           return false;
+
+    words[i / 8] = (words[i / 8] << 4) | nibble;
+  }
+
+  // The perfect hash (see create_props.pl) gives the only possible entry
+  const uInt32 d = DefPropsDisplace[words[2] % DEF_PROPS_BUCKETS];
+  const uInt32 slot = (words[0] + d * (words[1] | 1)) % DEF_PROPS_SLOTS;
+  index = DefPropsSlots[slot];
+
+  return std::equal(words.begin(), words.end(), DefPropsMD5[index].begin());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PropertiesSet::loadBuiltIn(uInt32 index, Properties& properties)
+{
+  // Only the non-default values are stored
+  for(uInt8 p = 0; p < static_cast<uInt8>(PropType::NumTypes); ++p)
+    if(DefProps[index][p] != 0)
+      properties.set(PropType(p), DefPropsStrings[DefProps[index][p]]);
+
+  static constexpr char HEX[] = "0123456789abcdef";
+  string md5(32, '0');
+  for(uInt32 i = 0; i < 32; ++i)
+    md5[i] = HEX[(DefPropsMD5[index][i / 8] >> (28 - (i % 8) * 4)) & 0xf];
+  properties.set(PropType::Cart_MD5, md5);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PropertiesSet::insert(const Properties& properties, bool save)
 {
@@ -197,11 +225,9 @@ void PropertiesSet::print() const
   for(uInt32 i = 0; i < DEF_PROPS_SIZE; ++i)
   {
     properties.setDefaults();
-    for(uInt8 p = 0; p < static_cast<uInt8>(PropType::NumTypes); ++p)
-      if(DefProps[i][p][0] != 0)
-        properties.set(PropType(p), DefProps[i][p]);
+    loadBuiltIn(i, properties);
 
-    list.emplace(DefProps[i][static_cast<uInt8>(PropType::Cart_MD5)], properties);
+    list.emplace(properties.get(PropType::Cart_MD5), properties);
   }
 
   // Now, print the resulting list
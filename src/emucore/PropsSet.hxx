@@ -89,6 +89,25 @@ class PropertiesSet
     */
     void print() const;
 
+  private:
+    /**
+      Find the entry with the given MD5 in the built-in properties.
+
+      @param md5    The md5 of the entry to find
+      @param index  The index of the entry, if found
+
+      @return  True if the entry was found, else false
+    */
+    static bool findBuiltIn(const string& md5, uInt32& index);
+
+    /**
+      Load the built-in properties entry with the given index.
+
+      @param index       The index of the entry
+      @param properties  The properties to load the entry into
+    */
+    static void loadBuiltIn(uInt32 index, Properties& properties);
+
   private:
     using PropsList = std::map<string, Properties>;
 
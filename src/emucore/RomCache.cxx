@@ -0,0 +1,125 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include <mutex>
+#include <unordered_map>
+
+#include "RomCache.hxx"
+
+namespace {
+  struct Image {
+    ByteBuffer data;
+    uInt32 refs{0};
+  };
+
+  struct Cache {
+    std::mutex mutex;
+
+    // The ROM images by key, and the keys of the ROM images by their data
+    std::unordered_map<string, Image> images;
+    std::unordered_map<const uInt8*, string> imageKeys;
+
+    // The tables by key; expired entries are removed when a table is added
+    std::unordered_map<string, std::weak_ptr<const void>> tables;
+  };
+
+  // The cache is never destroyed, since cartridges owned by other static
+  // objects may still return their ROM images to it at exit
+  Cache& cache()
+  {
+    static Cache* const theCache = new Cache;
+    return *theCache;
+  }
+} // namespace
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ByteBuffer RomCache::image(const string& key, size_t size, const ImageFill& fill)
+{
+  Cache& c = cache();
+  std::lock_guard<std::mutex> lock(c.mutex);
+
+  Image& image = c.images[key];
+  if(!image.data)
+  {
+    image.data = make_unique<uInt8[]>(size);
+    fill(image.data.get());
+    c.imageKeys[image.data.get()] = key;
+  }
+  ++image.refs;
+
+  return ByteBuffer(image.data.get(), ByteBufferDeleter(release, size));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomCache::unshare(ByteBuffer& image, size_t size)
+{
+  {
+    Cache& c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+
+    if(c.imageKeys.find(image.get()) == c.imageKeys.end())
+      return false;
+  }
+
+  ByteBuffer copy = make_unique<uInt8[]>(size);
+  std::copy_n(image.get(), size, copy.get());
+  image = std::move(copy);  // returns the borrowed image
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<const void> RomCache::table(const string& key,
+    const std::function<shared_ptr<const void>()>& create)
+{
+  Cache& c = cache();
+  std::lock_guard<std::mutex> lock(c.mutex);
+
+  const auto iter = c.tables.find(key);
+  if(iter != c.tables.end())
+  {
+    shared_ptr<const void> table = iter->second.lock();
+    if(table)
+      return table;
+  }
+
+  for(auto i = c.tables.begin(); i != c.tables.end(); )
+    i = i->second.expired() ? c.tables.erase(i) : std::next(i);
+
+  shared_ptr<const void> table = create();
+  c.tables[key] = table;
+
+  return table;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomCache::release(uInt8* image, size_t)
+{
+  Cache& c = cache();
+  std::lock_guard<std::mutex> lock(c.mutex);
+
+  const auto key = c.imageKeys.find(image);
+  if(key == c.imageKeys.end())
+    return;
+
+  const auto iter = c.images.find(key->second);
+  if(--iter->second.refs == 0)
+  {
+    c.imageKeys.erase(key);
+    c.images.erase(iter);  // deletes the image
+  }
+}
@@ -0,0 +1,108 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef ROM_CACHE_HXX
+#define ROM_CACHE_HXX
+
+#include "bspf.hxx"
+
+/**
+  A process-wide cache for the read-only data of ROM images.  Console
+  instances running the same ROM (ie, in a batch runner or the libretro
+  core) borrow the same ROM image and the same tables derived from it,
+  instead of each creating their own copy.
+
+  The data is identified by a key, which is the MD5 sum of the ROM plus
+  whatever else the data depends on (ie, the cart type, which determines
+  how the ROM image is laid out).  It is reference counted, and removed
+  from the cache when the last cartridge borrowing it is destroyed.
+
+  Borrowed data must never be written to; a borrowed ROM image has to be
+  unshared before it is patched.
+*/
+class RomCache
+{
+  public:
+    // Fills a new ROM image (of the requested size) with its data
+    using ImageFill = std::function<void(uInt8*)>;
+
+    /**
+      Borrow the ROM image with the given key, creating it if it isn't
+      in the cache yet.
+
+      @param key   Identifies the ROM image
+      @param size  The size of the ROM image
+      @param fill  Fills the ROM image, if it has to be created
+
+      @return  The ROM image, which is returned to the cache when the
+               buffer is released
+    */
+    static ByteBuffer image(const string& key, size_t size, const ImageFill& fill);
+
+    /**
+      Replace a ROM image borrowed from the cache by a private copy, so that
+      it can be written to.  Other ROM images are left alone.
+
+      @param image  The ROM image
+      @param size   The size of the ROM image
+
+      @return  True if the image was replaced; any pointers into it must
+               then be updated
+    */
+    static bool unshare(ByteBuffer& image, size_t size);
+
+    /**
+      Borrow the table with the given key, creating it if it isn't in the
+      cache yet.
+
+      @param key     Identifies the table
+      @param create  Creates the table, if it isn't in the cache
+
+      @return  The table, which is removed from the cache when the last
+               pointer to it is released
+    */
+    template<typename T>
+    static shared_ptr<const T> table(const string& key,
+                                     const std::function<shared_ptr<const T>()>& create)
+    {
+      return std::static_pointer_cast<const T>(
+        table(key, [&]() -> shared_ptr<const void> { return create(); }));
+    }
+
+  private:
+    /**
+      Borrow the (type-erased) table with the given key.
+    */
+    static shared_ptr<const void> table(const string& key,
+        const std::function<shared_ptr<const void>()>& create);
+
+    /**
+      Return a borrowed ROM image to the cache; this is the release function
+      of the buffers handed out by image().
+    */
+    static void release(uInt8* image, size_t size);
+
+  private:
+    // Following constructors and assignment operators not supported
+    RomCache() = delete;
+    RomCache(const RomCache&) = delete;
+    RomCache(RomCache&&) = delete;
+    RomCache& operator=(const RomCache&) = delete;
+    RomCache& operator=(RomCache&&) = delete;
+};
+
+#endif
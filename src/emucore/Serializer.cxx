@@ -93,6 +93,19 @@ size_t Serializer::size() const
   return myStream->tellp();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+size_t Serializer::writePos() const
+{
+  return myStream->tellp();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Serializer::seekRead(size_t pos) const
+{
+  myStream->clear();
+  myStream->seekg(pos);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt8 Serializer::getByte() const
 {
@@ -69,6 +69,18 @@ class Serializer
     */
     size_t size() const;
 
+    /**
+      Returns the current write position, without moving it (unlike size()).
+    */
+    size_t writePos() const;
+
+    /**
+      Moves the read pointer to the given location.
+
+      @param pos  The location in the stream to read from next
+    */
+    void seekRead(size_t pos) const;
+
     /**
       Reads a byte value (unsigned 8-bit) from the current input stream.
 
@@ -131,6 +131,7 @@ Settings::Settings()
   setPermanent("sssingle", "false");
   setPermanent("ss1x", "false");
   setPermanent("ssinterval", "2");
+  setPermanent("sscompress", "6");
   setPermanent("autoslot", "false");
   setPermanent("saveonexit", "none");
 
@@ -376,6 +377,10 @@ void Settings::validate()
   if(i < 1)        setValue("ssinterval", "2");
   else if(i > 10)  setValue("ssinterval", "10");
 
+  i = getInt("sscompress");
+  if(i < 0)        setValue("sscompress", "0");
+  else if(i > 9)   setValue("sscompress", "9");
+
   s = getString("palette");
   if(s != PaletteHandler::SETTING_STANDARD
      && s != PaletteHandler::SETTING_Z26
@@ -527,6 +532,8 @@ void Settings::usage() const
     << "                                scaling/effects)\n"
     << "  -ssinterval   <number>       Number of seconds between snapshots in\n"
     << "                                continuous snapshot mode\n"
+    << "  -sscompress   <0-9>          Compression level of snapshots (lower is\n"
+    << "                                faster)\n"
     << endl
     << "  -saveonexit   <none|current| Automatically save state(s) when exiting\n"
     << "                 all>           emulation\n"
@@ -719,23 +726,50 @@ void Settings::setValue(const string& key, const Variant& value, bool persist)
 {
   auto it = myPermanentSettings.find(key);
   if(it != myPermanentSettings.end()) {
-    if (persist && it->second != value && myRespository->atomic()) myRespository->atomic()->save(key, value);
+    if(it->second == value)
+      return;
+    if (persist && myRespository->atomic()) myRespository->atomic()->save(key, value);
     it->second = value;
   }
   else
     myTemporarySettings[key] = value;
+
+  updateHandles(key);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::setPermanent(const string& key, const Variant& value)
 {
   myPermanentSettings[key] = value;
+  updateHandles(key);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::setTemporary(const string& key, const Variant& value)
 {
   myTemporarySettings[key] = value;
+  updateHandles(key);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const Settings::Entry& Settings::entry(const string& key) const
+{
+  auto [it, inserted] = myEntries.try_emplace(key);
+  if(inserted)
+    it->second.value = &value(key);
+
+  return it->second;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Settings::updateHandles(const string& key)
+{
+  auto it = myEntries.find(key);
+  if(it != myEntries.end())
+  {
+    it->second.value = &value(key);
+    ++it->second.revision;
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
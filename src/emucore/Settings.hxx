@@ -106,6 +106,69 @@ class Settings
     const Common::Size getSize(const string& key) const { return value(key).toSize(); }
     const Common::Point getPoint(const string& key) const { return value(key).toPoint(); }
 
+  private:
+    // The state shared by all handles to the same key; 'revision' is
+    // incremented each time the value of the setting changes
+    struct Entry {
+      const Variant* value{&EmptyVariant};
+      uInt32 revision{1};
+    };
+
+  public:
+    /**
+      A typed handle to a single setting, for code which reads a setting
+      repeatedly (ie, on each reset).  The key is resolved only once when
+      the handle is created; afterwards the converted value is cached, and
+      only converted again after the setting has been changed.
+
+      Handles must not outlive the Settings object they were created from.
+    */
+    template<typename T>
+    class Handle
+    {
+      friend class Settings;
+
+      public:
+        /**
+          Get the current value of the setting.
+        */
+        const T& get() const {
+          if(myRevision != myEntry->revision)
+          {
+            convert(*myEntry->value, myValue);
+            myRevision = myEntry->revision;
+          }
+          return myValue;
+        }
+        operator const T&() const { return get(); }  // NOLINT
+
+        /**
+          Answer whether the setting has changed since its value was last
+          read through this handle (a handle never read reports a change).
+        */
+        bool changed() const { return myRevision != myEntry->revision; }
+
+      private:
+        explicit Handle(const Entry& entry) : myEntry{&entry} { }
+
+      private:
+        const Entry* myEntry{nullptr};
+        mutable T myValue{};
+        mutable uInt32 myRevision{0};
+    };
+
+    /**
+      Create a typed handle to the specified setting.  Only int, float,
+      bool and string handles are supported.
+
+      @param key  The key of the setting
+      @return  A handle to the setting, valid for the lifetime of this object
+    */
+    template<typename T>
+    Handle<T> handle(const string& key) const {
+      return Handle<T>(entry(key));
+    }
+
   protected:
     /**
       Add key/value pair to specified map.  Note that these should only be called
@@ -133,6 +196,25 @@ class Settings
      */
     void migrate();
 
+    /**
+      Find or create the handle entry for the specified key.
+    */
+    const Entry& entry(const string& key) const;
+
+    /**
+      Point the handles of the specified key to its current value, and
+      mark them as changed.
+    */
+    void updateHandles(const string& key);
+
+    /**
+      Convert a variant into the type of a handle.
+    */
+    static void convert(const Variant& v, int& value)    { value = v.toInt();    }
+    static void convert(const Variant& v, float& value)  { value = v.toFloat();  }
+    static void convert(const Variant& v, bool& value)   { value = v.toBool();   }
+    static void convert(const Variant& v, string& value) { value = v.toString(); }
+
   private:
     // Holds key/value pairs that are necessary for Stella to
     // function and must be saved on each program exit.
@@ -144,6 +226,10 @@ class Settings
 
     shared_ptr<KeyValueRepository> myRespository;
 
+    // The entries shared by the handles of each key; these are only ever
+    // added, so handles can keep pointers to them
+    mutable std::map<string, Entry> myEntries;
+
   private:
     // Following constructors and assignment operators not supported
     Settings(const Settings&) = delete;
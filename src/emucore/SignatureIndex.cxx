@@ -0,0 +1,83 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "SignatureIndex.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+SignatureIndex::SignatureIndex(const ByteBuffer& image, size_t size)
+  : myImage{image.get()},
+    mySize{size},
+    myStart(65536 + 1, 0)
+{
+  // Counting sort of all byte pair positions, first count each pair ...
+  const size_t numPairs = size > 1 ? size - 1 : 0;
+  for(size_t i = 0; i < numPairs; ++i)
+    ++myStart[pairOf(myImage[i], myImage[i + 1]) + 1];
+
+  // ... then turn the counts into start offsets ...
+  for(uInt32 p = 1; p < myStart.size(); ++p)
+    myStart[p] += myStart[p - 1];
+
+  // ... and finally store the positions, which leaves them sorted
+  vector<uInt32> next(myStart.begin(), myStart.end() - 1);
+  myPositions.resize(numPairs);
+  for(size_t i = 0; i < numPairs; ++i)
+    myPositions[next[pairOf(myImage[i], myImage[i + 1])]++] = uInt32(i);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool SignatureIndex::search(size_t imagesize, const uInt8* signature,
+                            uInt32 sigsize, uInt32 minhits) const
+{
+  imagesize = std::min(imagesize, mySize);
+  if(sigsize < 2 || imagesize <= sigsize)
+  {
+    // Too short to be indexed, or too long to be found
+    uInt32 count = 0;
+    for(size_t i = 0; i + sigsize < imagesize; ++i)
+      if(std::equal(signature, signature + sigsize, myImage + i))
+      {
+        if(++count == minhits)
+          return true;
+        i += sigsize;
+      }
+    return false;
+  }
+
+  const uInt32 pair = pairOf(signature[0], signature[1]);
+  const size_t end = imagesize - sigsize;
+  size_t from = 0;
+  uInt32 count = 0;
+
+  for(uInt32 p = myStart[pair]; p < myStart[pair + 1]; ++p)
+  {
+    const size_t i = myPositions[p];
+    if(i >= end)
+      break;
+    if(i < from)
+      continue;
+
+    if(std::equal(signature + 2, signature + sigsize, myImage + i + 2))
+    {
+      if(++count == minhits)
+        return true;
+      from = i + sigsize + 1;  // skip past this signature 'window' entirely
+    }
+  }
+
+  return false;
+}
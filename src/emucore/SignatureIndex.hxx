@@ -0,0 +1,93 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef SIGNATURE_INDEX_HXX
+#define SIGNATURE_INDEX_HXX
+
+#include "bspf.hxx"
+
+/**
+  Index of all byte pairs in a ROM image, used to search the image for
+  many different byte signatures.
+
+  The image is scanned once when the index is created; afterwards, each
+  signature search only visits the positions where the first two bytes of
+  the signature occur, instead of walking the whole image again.  The
+  autodetection code searches each image for several hundred signatures,
+  so this replaces one pass over the image per signature with a single one.
+
+  The index also gives the same read access to the image as the ByteBuffer
+  it was created from, so it can be passed around in its place.
+*/
+class SignatureIndex
+{
+  public:
+    /**
+      Create a new index for the given image.  The image must outlive
+      the index.
+
+      @param image  A pointer to the ROM image
+      @param size   The size of the ROM image
+    */
+    SignatureIndex(const ByteBuffer& image, size_t size);
+    ~SignatureIndex() = default;
+
+    /**
+      Search the image for the specified byte signature.
+
+      Matches are counted exactly as a linear search would: a match must
+      start before offset 'imagesize - sigsize', and after a match the
+      search continues 'sigsize + 1' bytes later.
+
+      @param imagesize  Only search the first 'imagesize' bytes of the image
+      @param signature  The byte sequence to search for
+      @param sigsize    The number of bytes in the signature
+      @param minhits    The minimum number of times a signature is to be found
+
+      @return  True if the signature was found at least 'minhits' time, else false
+    */
+    bool search(size_t imagesize, const uInt8* signature, uInt32 sigsize,
+                uInt32 minhits = 1) const;
+
+    const uInt8* get() const { return myImage; }
+    uInt8 operator[](size_t i) const { return myImage[i]; }
+    size_t size() const { return mySize; }
+
+  private:
+    static constexpr uInt32 pairOf(uInt8 first, uInt8 second) {
+      return (uInt32(first) << 8) | second;
+    }
+
+  private:
+    const uInt8* myImage{nullptr};
+    size_t mySize{0};
+
+    // Image offsets of each byte pair, in ascending order; the offsets of
+    // pair 'p' are stored in myPositions[myStart[p] .. myStart[p+1])
+    vector<uInt32> myStart;
+    vector<uInt32> myPositions;
+
+  private:
+    // Following constructors and assignment operators not supported
+    SignatureIndex() = delete;
+    SignatureIndex(const SignatureIndex&) = delete;
+    SignatureIndex(SignatureIndex&&) = delete;
+    SignatureIndex& operator=(const SignatureIndex&) = delete;
+    SignatureIndex& operator=(SignatureIndex&&) = delete;
+};
+
+#endif
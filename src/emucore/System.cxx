@@ -36,8 +36,10 @@ System::System(Random& random, M6502& m6502, M6532& m6532,
     myCart{mCart}
 {
   // Initialize page access table
-  PageAccess access(&myNullDevice, System::PageAccessType::READ);
-  myPageAccessTable.fill(access);
+  myPageDirectPeekBase.fill(nullptr);
+  myPageDirectPokeBase.fill(nullptr);
+  myPageDevice.fill(&myNullDevice);
+  myPageDebugInfo.fill(PageDebugInfo());
   myPageIsDirtyTable.fill(false);
 
   // Bus starts out unlocked (in other words, peek() changes myDataBusState)
@@ -101,30 +103,34 @@ void System::clearDirtyPages()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt8 System::peek(uInt16 addr, Device::AccessFlags flags)
 {
-  const PageAccess& access = getPageAccess(addr);
+  const uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
+  Device* device = myPageDevice[page];
 
 #ifdef DEBUGGER_SUPPORT
+  const PageDebugInfo& info = myPageDebugInfo[page];
+
   // Set access type
-  if(access.romAccessBase)
-    *(access.romAccessBase + (addr & PAGE_MASK)) |= (flags | (addr & Device::HADDR));
+  if(info.romAccessBase)
+    *(info.romAccessBase + (addr & PAGE_MASK)) |= (flags | (addr & Device::HADDR));
   else
-    access.device->setAccessFlags(addr, flags);
+    device->setAccessFlags(addr, flags);
   // Increase access counter
   if(flags != Device::NONE)
   {
-    if(access.romPeekCounter)
-      *(access.romPeekCounter + (addr & PAGE_MASK)) += 1;
+    if(info.romPeekCounter)
+      *(info.romPeekCounter + (addr & PAGE_MASK)) += 1;
     else
-      access.device->increaseAccessCounter(addr);
+      device->increaseAccessCounter(addr);
   }
 #endif
 
   // See if this page uses direct accessing or not
   uInt8 result;
-  if(access.directPeekBase)
-    result = *(access.directPeekBase + (addr & PAGE_MASK));
+  const uInt8* directPeekBase = myPageDirectPeekBase[page];
+  if(directPeekBase)
+    result = *(directPeekBase + (addr & PAGE_MASK));
   else
-    result = access.device->peek(addr);
+    result = device->peek(addr);
 
 #ifdef DEBUGGER_SUPPORT
   if(!myDataBusLocked)
@@ -137,36 +143,39 @@ uInt8 System::peek(uInt16 addr, Device::AccessFlags flags)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void System::poke(uInt16 addr, uInt8 value, Device::AccessFlags flags)
 {
-  uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
-  const PageAccess& access = myPageAccessTable[page];
+  const uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
+  Device* device = myPageDevice[page];
 
 #ifdef DEBUGGER_SUPPORT
+  const PageDebugInfo& info = myPageDebugInfo[page];
+
   // Set access type
-  if(access.romAccessBase)
-    *(access.romAccessBase + (addr & PAGE_MASK)) |= (flags | (addr & Device::HADDR));
+  if(info.romAccessBase)
+    *(info.romAccessBase + (addr & PAGE_MASK)) |= (flags | (addr & Device::HADDR));
   else
-    access.device->setAccessFlags(addr, flags);
+    device->setAccessFlags(addr, flags);
   // Increase access counter
   if(flags != Device::NONE)
   {
-    if(access.romPokeCounter)
-      *(access.romPokeCounter + (addr & PAGE_MASK)) += 1;
+    if(info.romPokeCounter)
+      *(info.romPokeCounter + (addr & PAGE_MASK)) += 1;
     else
-      access.device->increaseAccessCounter(addr, true);
+      device->increaseAccessCounter(addr, true);
   }
 #endif
 
   // See if this page uses direct accessing or not
-  if(access.directPokeBase)
+  uInt8* directPokeBase = myPageDirectPokeBase[page];
+  if(directPokeBase)
   {
     // Since we have direct access to this poke, we can dirty its page
-    *(access.directPokeBase + (addr & PAGE_MASK)) = value;
+    *(directPokeBase + (addr & PAGE_MASK)) = value;
     myPageIsDirtyTable[page] = true;
   }
   else
   {
     // The specific device informs us if the poke succeeded
-    myPageIsDirtyTable[page] = access.device->poke(addr, value);
+    myPageIsDirtyTable[page] = device->poke(addr, value);
   }
 
 #ifdef DEBUGGER_SUPPORT
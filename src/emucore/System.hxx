@@ -303,7 +303,13 @@ class System : public Serializable
       @param access The accessing methods to be used by the page
     */
     void setPageAccess(uInt16 addr, const PageAccess& access) {
-      myPageAccessTable[(addr & ADDRESS_MASK) >> PAGE_SHIFT] = access;
+      const uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
+
+      myPageDirectPeekBase[page] = access.directPeekBase;
+      myPageDirectPokeBase[page] = access.directPokeBase;
+      myPageDevice[page] = access.device;
+      myPageDebugInfo[page] = { access.romAccessBase, access.romPeekCounter,
+                                access.romPokeCounter, access.type };
     }
 
     /**
@@ -312,8 +318,18 @@ class System : public Serializable
       @param addr  The address/page to get accessing methods for
       @return The accessing methods used by the page
     */
-    const PageAccess& getPageAccess(uInt16 addr) const {
-      return myPageAccessTable[(addr & ADDRESS_MASK) >> PAGE_SHIFT];
+    PageAccess getPageAccess(uInt16 addr) const {
+      const uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
+      const PageDebugInfo& info = myPageDebugInfo[page];
+
+      PageAccess access(myPageDevice[page], info.type);
+      access.directPeekBase = myPageDirectPeekBase[page];
+      access.directPokeBase = myPageDirectPokeBase[page];
+      access.romAccessBase = info.romAccessBase;
+      access.romPeekCounter = info.romPeekCounter;
+      access.romPokeCounter = info.romPokeCounter;
+
+      return access;
     }
 
     /**
@@ -323,7 +339,7 @@ class System : public Serializable
       @return  The type of page that contains the given address
     */
     System::PageAccessType getPageAccessType(uInt16 addr) const {
-      return myPageAccessTable[(addr & ADDRESS_MASK) >> PAGE_SHIFT].type;
+      return myPageDebugInfo[(addr & ADDRESS_MASK) >> PAGE_SHIFT].type;
     }
 
     /**
@@ -387,8 +403,21 @@ class System : public Serializable
     // Null device to use for page which are not installed
     NullDevice myNullDevice;
 
-    // The list of PageAccess structures
-    std::array<PageAccess, NUM_PAGES> myPageAccessTable;
+    // The page access table, stored as separate arrays for each field
+    // used on every access, so that peek() and poke() only touch a few
+    // cache lines.  The remaining (mostly debugger) fields are kept apart.
+    std::array<uInt8*, NUM_PAGES> myPageDirectPeekBase;
+    std::array<uInt8*, NUM_PAGES> myPageDirectPokeBase;
+    std::array<Device*, NUM_PAGES> myPageDevice;
+
+    struct PageDebugInfo
+    {
+      Device::AccessFlags* romAccessBase{nullptr};
+      Device::AccessCounter* romPeekCounter{nullptr};
+      Device::AccessCounter* romPokeCounter{nullptr};
+      PageAccessType type{PageAccessType::READ};
+    };
+    std::array<PageDebugInfo, NUM_PAGES> myPageDebugInfo;
 
     // The list of dirty pages
     std::array<bool, NUM_PAGES> myPageIsDirtyTable;
@@ -53,9 +53,10 @@ TIASurface::TIASurface(OSystem& system)
   myNTSCFilter.loadConfig(myOSystem.settings());
 
   // Create a surface for the TIA image and scanlines; we'll need them eventually
+  // (the TIA image uses twice the height when scanlines are applied directly)
   myTiaSurface = myFB.allocateSurface(
     AtariNTSC::outWidth(TIAConstants::frameBufferWidth),
-    TIAConstants::frameBufferHeight,
+    TIAConstants::frameBufferHeight * 2,
     !correctAspect()
       ? ScalingInterpolation::none
       : interpolationModeFromSettings(myOSystem.settings())
@@ -149,6 +150,11 @@ void TIASurface::setPalette(const PaletteArray& tia_palette,
                             const PaletteArray& rgb_palette)
 {
   myPalette = tia_palette;
+  myRGBPalette = rgb_palette;
+  myRenderAll = true;
+
+  if(mySLineSinglePass)
+    updateScanlinePalette();
 
   // The NTSC filtering needs access to the raw RGB data, since it calculates
   // its own internal palette
@@ -292,6 +298,11 @@ void TIASurface::enablePhosphor(bool enable, int blend)
   {
     myFilter = Filter(enable ? uInt8(myFilter) | 0x01 : uInt8(myFilter) & 0x10);
     myRGBFramebuffer.fill(0);
+    myRenderAll = true;
+
+    // The scanlines may have to be switched between single- and two-pass
+    if(myTIA)
+      enableNTSC(ntscEnabled());
   }
 }
 
@@ -300,24 +311,36 @@ void TIASurface::enableNTSC(bool enable)
 {
   myFilter = Filter(enable ? uInt8(myFilter) | 0x10 : uInt8(myFilter) & 0x01);
 
+  myScanlinesEnabled = myOSystem.settings().getInt("tv.scanlines") > 0;
+
+  // Blending the scanline overlay is expensive for the software renderer;
+  // so without TV effects, the scanlines are applied while converting the
+  // TIA image instead (which then has two rows per scanline)
+  mySLineSinglePass = myScanlinesEnabled && myFilter == Filter::Normal &&
+                      myOSystem.settings().getString("video") == "software";
+
   uInt32 surfaceWidth = enable ?
     AtariNTSC::outWidth(TIAConstants::frameBufferWidth) : TIAConstants::frameBufferWidth;
+  uInt32 surfaceHeight = myTIA->height() * (mySLineSinglePass ? 2 : 1);
 
-  if (surfaceWidth != myTiaSurface->srcRect().w() || myTIA->height() != myTiaSurface->srcRect().h()) {
-    myTiaSurface->setSrcSize(surfaceWidth, myTIA->height());
+  if (surfaceWidth != myTiaSurface->srcRect().w() || surfaceHeight != myTiaSurface->srcRect().h()) {
+    myTiaSurface->setSrcSize(surfaceWidth, surfaceHeight);
 
     myTiaSurface->invalidate();
   }
 
   mySLineSurface->setSrcSize(1, 2 * myTIA->height());
 
-  myScanlinesEnabled = myOSystem.settings().getInt("tv.scanlines") > 0;
   FBSurface::Attributes& sl_attr = mySLineSurface->attributes();
   sl_attr.blending   = myScanlinesEnabled;
   sl_attr.blendalpha = myOSystem.settings().getInt("tv.scanlines");
   mySLineSurface->applyAttributes();
 
+  if(mySLineSinglePass)
+    updateScanlinePalette();
+
   myRGBFramebuffer.fill(0);
+  myRenderAll = true;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -383,22 +406,58 @@ void TIASurface::render(bool shade)
   {
     case Filter::Normal:
     {
-      uInt8* tiaIn = myTIA->frameBuffer();
+      // Only convert (and upload) the scanlines which changed since the
+      // previous frame; most games redraw (almost) the same screen
+      const uInt8* tiaIn = myTIA->frameBuffer();
+      const bool renderAll = myRenderAll || height != myPrevHeight;
+      uInt32 firstDirty = height, lastDirty = 0;
+
+      // In single-pass scanline mode, each scanline is followed by a
+      // darkened copy
+      const uInt32 rowsPerLine = mySLineSinglePass ? 2 : 1;
 
       uInt32 bufofs = 0, screenofsY = 0, pos;
-      for(uInt32 y = 0; y < height; ++y)
+      for(uInt32 y = 0; y < height; ++y, screenofsY += outPitch * rowsPerLine)
       {
+        uInt8* prevIn = myPrevFramebuffer.data() + bufofs;
+        if(!renderAll && std::equal(tiaIn + bufofs, tiaIn + bufofs + width, prevIn))
+        {
+          bufofs += width;
+          continue;
+        }
+        std::copy_n(tiaIn + bufofs, width, prevIn);
+        firstDirty = std::min(firstDirty, y);
+        lastDirty = y;
+
+        if(mySLineSinglePass)
+        {
+          uInt32* line = out + screenofsY;
+          uInt32* darkLine = line + outPitch;
+          for (uInt32 x = width; x; --x)
+          {
+            const uInt8 color = tiaIn[bufofs++];
+            *line++ = myPalette[color];
+            *darkLine++ = myScanlinePalette[color];
+          }
+          continue;
+        }
+
         pos = screenofsY;
         for (uInt32 x = width / 2; x; --x)
         {
           out[pos++] = myPalette[tiaIn[bufofs++]];
           out[pos++] = myPalette[tiaIn[bufofs++]];
         }
-        screenofsY += outPitch;
       }
+      myTiaSurface->setDirtyRows(firstDirty * rowsPerLine,
+          firstDirty <= lastDirty ? (lastDirty - firstDirty + 1) * rowsPerLine : 0);
+      myRenderAll = false;
+      myPrevHeight = height;
       break;
     }
 
+    // The remaining filters depend on more than the current frame, so they
+    // are always rendered completely
     case Filter::Phosphor:
     {
       uInt8*  tiaIn = myTIA->frameBuffer();
@@ -446,7 +505,7 @@ void TIASurface::render(bool shade)
   myTiaSurface->render();
 
   // Draw overlaying scanlines
-  if(myScanlinesEnabled)
+  if(myScanlinesEnabled && !mySLineSinglePass)
     mySLineSurface->render();
 
   if(shade)
@@ -520,11 +579,27 @@ void TIASurface::renderForSnapshot()
     myTiaSurface->render();
 
     // Draw overlaying scanlines
-    if(myScanlinesEnabled)
+    if(myScanlinesEnabled && !mySLineSinglePass)
       mySLineSurface->render();
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIASurface::updateScanlinePalette()
+{
+  // Same result as blending black with the given intensity
+  const uInt32 factor = 100 - myOSystem.settings().getInt("tv.scanlines");
+
+  for(size_t i = 0; i < myRGBPalette.size(); ++i)
+  {
+    const uInt32 rgb = myRGBPalette[i];
+    myScanlinePalette[i] = myFB.mapRGB(((rgb >> 16) & 0xff) * factor / 100,
+                                       ((rgb >> 8) & 0xff) * factor / 100,
+                                       (rgb & 0xff) * factor / 100);
+  }
+  myRenderAll = true;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIASurface::updateSurfaceSettings()
 {
@@ -547,6 +622,7 @@ void TIASurface::resetSurfaces()
 {
   myTiaSurface->reload();
   mySLineSurface->reload();
+  myRenderAll = true;
   myBaseTiaSurface->reload();
   myShadeSurface->reload();
 }
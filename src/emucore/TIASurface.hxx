@@ -194,6 +194,12 @@ class TIASurface
     */
     uInt32 averageBuffers(uInt32 bufOfs);
 
+    /**
+      Calculate the palette for darkened scanlines from the RGB palette and
+      the current scanline intensity.
+    */
+    void updateScanlinePalette();
+
     // Is plain video mode enabled?
     bool correctAspect() const;
 
@@ -232,9 +238,26 @@ class TIASurface
     // Use scanlines in TIA rendering mode
     bool myScanlinesEnabled{false};
 
+    // Apply scanlines while converting the TIA image (instead of blending
+    // the scanline surface)
+    bool mySLineSinglePass{false};
+
     // Palette for normal TIA rendering mode
     PaletteArray myPalette;
 
+    // The raw RGB palette, and the palette for darkened scanlines derived
+    // from it (used in single-pass scanline mode)
+    PaletteArray myRGBPalette, myScanlinePalette;
+
+    // The TIA frame rendered last in normal TIA rendering mode, used to
+    // determine which scanlines changed
+    std::array<uInt8, TIAConstants::frameBufferWidth *
+        TIAConstants::frameBufferHeight> myPrevFramebuffer;
+    uInt32 myPrevHeight{0};
+
+    // Render the next frame completely (e.g. after palette changes)
+    bool myRenderAll{true};
+
     // Flag for saving a snapshot
     bool mySaveSnapFlag{false};
 
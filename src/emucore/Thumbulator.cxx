@@ -25,6 +25,7 @@
 #include "bspf.hxx"
 #include "Base.hxx"
 #include "Cart.hxx"
+#include "RomCache.hxx"
 #include "Thumbulator.hxx"
 using Common::Base;
 
@@ -54,6 +55,7 @@ using Common::Base;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Thumbulator::Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, uInt32 rom_size,
+                         const string& rom_key,
                          const uInt32 c_base, const uInt32 c_start, const uInt32 c_stack,
                          bool traponfatal, Thumbulator::ConfigureFor configurefor,
                          Cartridge* cartridge)
@@ -62,13 +64,15 @@ Thumbulator::Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, uInt32 rom_size
     cBase{c_base},
     cStart{c_start},
     cStack{c_stack},
-    decodedRom{make_unique<Op[]>(romSize / 2)},  // NOLINT
+    decodedRom{RomCache::table<Op[]>(rom_key + "/decoded",  // NOLINT
+      [&]() { return decodeRom(rom, romSize); })},
     ram{ram_ptr},
     configuration{configurefor},
     myCartridge{cartridge}
 {
-  for(uInt32 i = 0; i < romSize / 2; ++i)
-    decodedRom[i] = decodeInstructionWord(CONV_RAMROM(rom[i]));
+  // ROM and RAM are accessed directly, everything else is memory mapped I/O
+  memoryMap[0x0] = { rom, nullptr, ROMADDMASK };
+  memoryMap[0x4] = { ram, ram, RAMADDMASK };
 
   setConsoleTiming(ConsoleTiming::ntsc);
 #ifndef UNSAFE_OPTIMIZATIONS
@@ -83,6 +87,19 @@ string Thumbulator::run()
   reset();
   for(;;)
   {
+#ifndef NO_THUMB_STATS
+    if(_profiler)
+    {
+      // Attribute the instruction and its memory cycles to its address
+      const uInt32 instructionPtr = (reg_norm[15] & ~1U) - 2;
+      const uInt32 cycles = _stats.fetches + _stats.reads + _stats.writes;
+      const int done = execute();
+
+      _profiler->count(instructionPtr, _stats.fetches + _stats.reads + _stats.writes - cycles);
+      if(done) break;
+    }
+    else
+#endif
     if(execute()) break;
 #ifndef UNSAFE_OPTIMIZATIONS
     if(instructions > 500000) // way more than would otherwise be possible
@@ -98,6 +115,13 @@ string Thumbulator::run()
 #endif
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Thumbulator::setRom(const uInt16* rom_ptr)
+{
+  rom = rom_ptr;
+  memoryMap[0x0].readBase = rom;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Thumbulator::setConsoleTiming(ConsoleTiming timing)
 {
@@ -116,6 +140,17 @@ void Thumbulator::setConsoleTiming(ConsoleTiming timing)
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Thumbulator::enableProfiling(bool enable)
+{
+#ifndef NO_THUMB_STATS
+  if(enable && !_profiler)
+    _profiler = make_unique<ThumbulatorProfiler>(romSize, RAMSIZE);
+  else if(!enable)
+    _profiler.reset();
+#endif
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Thumbulator::updateTimer(uInt32 cycles)
 {
@@ -237,25 +272,18 @@ void Thumbulator::write16(uInt32 addr, uInt32 data)
 
   DO_DBUG(statusMsg << "write16(" << Base::HEX8 << addr << "," << Base::HEX8 << data << ")" << endl);
 
-  switch(addr & 0xF0000000)
+  const MemoryRegion& region = memoryMap[addr >> 28];
+  if(region.writeBase) //RAM
   {
-    case 0x40000000: //RAM
-      addr &= RAMADDMASK;
-      addr >>= 1;
-      ram[addr] = CONV_DATA(data);
-      return;
+    region.writeBase[(addr & region.mask) >> 1] = CONV_DATA(data);
+    return;
+  }
 
-#ifndef UNSAFE_OPTIMIZATIONS
-    case 0xE0000000: //MAMCR
-#else
-    default:
-#endif
-      if(addr == 0xE01FC000)
-      {
-        DO_DBUG(statusMsg << "write16(" << Base::HEX8 << "MAMCR" << "," << Base::HEX8 << data << ") *" << endl);
-        mamcr = data;
-        return;
-      }
+  if(addr == 0xE01FC000) //MAMCR
+  {
+    DO_DBUG(statusMsg << "write16(" << Base::HEX8 << "MAMCR" << "," << Base::HEX8 << data << ") *" << endl);
+    mamcr = data;
+    return;
   }
 #ifndef UNSAFE_OPTIMIZATIONS
   fatalError("write16", addr, data, "abort");
@@ -273,6 +301,23 @@ void Thumbulator::write32(uInt32 addr, uInt32 data)
 #endif
   DO_DBUG(statusMsg << "write32(" << Base::HEX8 << addr << "," << Base::HEX8 << data << ")" << endl);
 
+  const MemoryRegion& region = memoryMap[addr >> 28];
+  if(region.writeBase) //RAM
+  {
+#ifndef UNSAFE_OPTIMIZATIONS
+    if((addr & 0x0FFFFFFF) > region.mask)
+      fatalError("write32", addr, "abort - out of range");
+
+    if (isProtected(addr + 2)) fatalError("write32", addr + 2, "to driver area");
+#endif
+#ifndef NO_THUMB_STATS
+    _stats.writes += 2;
+#endif
+    region.writeBase[(addr & region.mask) >> 1] = CONV_DATA(data);
+    region.writeBase[((addr + 2) & region.mask) >> 1] = CONV_DATA(data >> 16);
+    return;
+  }
+
   switch(addr & 0xF0000000)
   {
 #ifndef UNSAFE_OPTIMIZATIONS
@@ -349,15 +394,6 @@ void Thumbulator::write32(uInt32 addr, uInt32 data)
       }
 #endif
       return;
-
-#ifndef UNSAFE_OPTIMIZATIONS
-    case 0x40000000: //RAM
-#else
-    default:
-#endif
-      write16(addr+0, (data >>  0) & 0xFFFF);
-      write16(addr+2, (data >> 16) & 0xFFFF);
-      return;
   }
 #ifndef UNSAFE_OPTIMIZATIONS
   fatalError("write32", addr, data, "abort");
@@ -396,7 +432,6 @@ bool Thumbulator::isProtected(uInt32 addr)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt32 Thumbulator::read16(uInt32 addr)
 {
-  uInt32 data;
 #ifndef UNSAFE_OPTIMIZATIONS
   if((addr > 0x40007fff) && (addr < 0x50000000))
     fatalError("read16", addr, "abort - out of range");
@@ -409,32 +444,20 @@ uInt32 Thumbulator::read16(uInt32 addr)
   ++_stats.reads;
 #endif
 
-  switch(addr & 0xF0000000)
+  const MemoryRegion& region = memoryMap[addr >> 28];
+  if(region.readBase) //ROM or RAM
   {
-    case 0x00000000: //ROM
-      addr &= ROMADDMASK;
-      addr >>= 1;
-      data = CONV_RAMROM(rom[addr]);
-      DO_DBUG(statusMsg << "read16(" << Base::HEX8 << addr << ")=" << Base::HEX4 << data << endl);
-      return data;
-
-    case 0x40000000: //RAM
-      addr &= RAMADDMASK;
-      addr >>= 1;
-      data = CONV_RAMROM(ram[addr]);
-      DO_DBUG(statusMsg << "read16(" << Base::HEX8 << addr << ")=" << Base::HEX4 << data << endl);
-      return data;
+    const uInt32 data = CONV_RAMROM(region.readBase[(addr & region.mask) >> 1]);
+    DO_DBUG(statusMsg << "read16(" << Base::HEX8 << addr << ")=" << Base::HEX4 << data << endl);
+    return data;
+  }
 
 #ifndef UNSAFE_OPTIMIZATIONS
-    case 0xE0000000: //MAMCR
-      if(addr == 0xE01FC000)
-#else
-    default:
+  if(addr == 0xE01FC000) //MAMCR
 #endif
-      {
-        DO_DBUG(statusMsg << "read16(" << "MAMCR" << addr << ")=" << mamcr << " *");
-        return mamcr;
-      }
+  {
+    DO_DBUG(statusMsg << "read16(" << "MAMCR" << addr << ")=" << mamcr << " *");
+    return mamcr;
   }
 #ifndef UNSAFE_OPTIMIZATIONS
   return fatalError("read16", addr, "abort");
@@ -450,15 +473,24 @@ uInt32 Thumbulator::read32(uInt32 addr)
 #endif
 
   uInt32 data;
-  switch(addr & 0xF0000000)
+  const MemoryRegion& region = memoryMap[addr >> 28];
+  if(region.readBase) //ROM or RAM
   {
-    case 0x00000000: //ROM
-    case 0x40000000: //RAM
-      data = read16(addr+0);
-      data |= (uInt32(read16(addr+2))) << 16;
-      DO_DBUG(statusMsg << "read32(" << Base::HEX8 << addr << ")=" << Base::HEX8 << data << endl);
-      return data;
+#ifndef UNSAFE_OPTIMIZATIONS
+    if((addr & 0x0FFFFFFF) > region.mask)
+      fatalError("read32", addr, "abort - out of range");
+#endif
+#ifndef NO_THUMB_STATS
+    _stats.reads += 2;
+#endif
+    data = CONV_RAMROM(region.readBase[(addr & region.mask) >> 1]);
+    data |= uInt32(CONV_RAMROM(region.readBase[((addr + 2) & region.mask) >> 1])) << 16;
+    DO_DBUG(statusMsg << "read32(" << Base::HEX8 << addr << ")=" << Base::HEX8 << data << endl);
+    return data;
+  }
 
+  switch(addr & 0xF0000000)
+  {
 #ifndef UNSAFE_OPTIMIZATIONS
     case 0xE0000000:
 #else
@@ -588,6 +620,18 @@ void Thumbulator::do_vflag_bit(uInt32 x)
   if(x) cpsr |= CPSR_V;  else cpsr &= ~CPSR_V;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<const Thumbulator::Op[]>
+Thumbulator::decodeRom(const uInt16* rom, uInt32 romSize)
+{
+  shared_ptr<Op[]> decoded(new Op[romSize / 2]);  // NOLINT
+
+  for(uInt32 i = 0; i < romSize / 2; ++i)
+    decoded[i] = decodeInstructionWord(CONV_RAMROM(rom[i]));
+
+  return decoded;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Thumbulator::Op Thumbulator::decodeInstructionWord(uint16_t inst) {
   //ADC
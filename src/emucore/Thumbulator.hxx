@@ -29,6 +29,7 @@ class Cartridge;
 
 #include "bspf.hxx"
 #include "Console.hxx"
+#include "ThumbulatorProfiler.hxx"
 
 #ifdef RETRON77
   #define UNSAFE_OPTIMIZATIONS
@@ -66,11 +67,32 @@ class Thumbulator
     #endif
     };
 
+    /**
+      Create a new ARM emulator.  The instructions of the ROM are decoded in
+      advance; the decoded ROM is shared with all other instances emulating
+      the same ROM (see RomCache).
+
+      @param rom_key  Identifies the ROM image in the RomCache
+    */
     Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, uInt32 rom_size,
+                const string& rom_key,
                 const uInt32 c_base, const uInt32 c_start, const uInt32 c_stack,
                 bool traponfatal, Thumbulator::ConfigureFor configurefor,
                 Cartridge* cartridge);
 
+    /**
+      Use another copy of the ROM image, ie. after the cartridge had to copy
+      its ROM image to patch it.  The ROM isn't decoded again: the operation
+      of each instruction is still taken from the table decoded from the
+      original (shared) image, while its operands and all data are read
+      from the new copy.  So a patch which turns an ARM instruction into a
+      different one isn't honoured; patches never updated the decoded
+      instructions, even before the table was shared.
+
+      @param rom_ptr  The new copy of the ROM image
+    */
+    void setRom(const uInt16* rom_ptr);
+
     /**
       Run the ARM code, and return when finished.  A runtime_error exception is
       thrown in case of any fatal errors/aborts (if enabled), containing the
@@ -83,6 +105,16 @@ class Thumbulator
     string run(uInt32 cycles);
     const Stats& stats() const { return _stats; }
 
+    /**
+      Enable or disable profiling of the executed ARM code.  Profiling
+      needs the memory statistics, so it is not available when these are
+      disabled (NO_THUMB_STATS).
+
+      @param enable  Create (or remove) the profiler
+    */
+    void enableProfiling(bool enable);
+    ThumbulatorProfiler* profiler() const { return _profiler.get(); }
+
 #ifndef UNSAFE_OPTIMIZATIONS
     /**
       Normally when a fatal error is encountered, the ARM emulation
@@ -172,6 +204,7 @@ class Thumbulator
     void updateTimer(uInt32 cycles);
 
     static Op decodeInstructionWord(uint16_t inst);
+    static shared_ptr<const Op[]> decodeRom(const uInt16* rom, uInt32 romSize);
 
     void do_zflag(uInt32 x);
     void do_nflag(uInt32 x);
@@ -193,14 +226,25 @@ class Thumbulator
     int execute();
     int reset();
 
+  private:
+    // Direct access to the ROM and RAM regions of the ARM address space,
+    // indexed by the upper four address bits; regions without a base
+    // pointer are memory mapped I/O and handled by the slow path
+    struct MemoryRegion {
+      const uInt16* readBase{nullptr};
+      uInt16* writeBase{nullptr};
+      uInt32 mask{0};
+    };
+
   private:
     const uInt16* rom{nullptr};
     uInt32 romSize{0};
     uInt32 cBase{0};
     uInt32 cStart{0};
     uInt32 cStack{0};
-    const unique_ptr<Op[]> decodedRom;  // NOLINT
+    const shared_ptr<const Op[]> decodedRom;  // NOLINT
     uInt16* ram{nullptr};
+    std::array<MemoryRegion, 16> memoryMap;
     std::array<uInt32, 16> reg_norm; // normal execution mode, do not have a thread mode
     uInt32 cpsr{0}, mamcr{0};
     bool handler_mode{false};
@@ -209,6 +253,7 @@ class Thumbulator
     uInt32 instructions{0};
   #endif
     Stats _stats;
+    unique_ptr<ThumbulatorProfiler> _profiler;
 
     // For emulation of LPC2103's timer 1, used for NTSC/PAL/SECAM detection.
     // Register names from documentation:
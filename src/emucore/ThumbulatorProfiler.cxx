@@ -0,0 +1,281 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include <map>
+
+#include "Base.hxx"
+#include "FSNode.hxx"
+#include "ThumbulatorProfiler.hxx"
+
+using Common::Base;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ThumbulatorProfiler::ThumbulatorProfiler(uInt32 romSize, uInt32 ramSize)
+  : myRomSize{romSize},
+    myRamSize{ramSize},
+    myCounters((romSize + ramSize) >> 1)
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbulatorProfiler::reset()
+{
+  std::fill(myCounters.begin(), myCounters.end(), Counter());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+size_t ThumbulatorProfiler::loadSymbols(const FilesystemNode& node)
+{
+  ByteBuffer buffer;
+  size_t size = 0;
+
+  try
+  {
+    size = node.read(buffer);
+  }
+  catch(...)
+  {
+    return 0;
+  }
+
+  mySymbols.clear();
+  if(!loadElfSymbols(buffer, size))
+    loadTextSymbols(buffer, size);
+
+  // Sort by address and drop aliases of the same address
+  std::stable_sort(mySymbols.begin(), mySymbols.end(),
+      [](const Symbol& a, const Symbol& b) { return a.address < b.address; });
+  mySymbols.erase(std::unique(mySymbols.begin(), mySymbols.end(),
+      [](const Symbol& a, const Symbol& b) { return a.address == b.address; }),
+      mySymbols.end());
+
+  return mySymbols.size();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+size_t ThumbulatorProfiler::loadSymbolsFor(const FilesystemNode& romFile)
+{
+  for(const auto& ext: { ".elf", ".map" })
+  {
+    const FilesystemNode node(romFile.getPathWithExt(ext));
+
+    if(node.exists())
+      return loadSymbols(node);
+  }
+  return 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ThumbulatorProfiler::loadElfSymbols(const ByteBuffer& buffer, size_t size)
+{
+  // Only 32 bit, little endian ELF files (as created for the ARM) are supported
+  if(size < 52 || buffer[0] != 0x7F || buffer[1] != 'E' || buffer[2] != 'L' ||
+     buffer[3] != 'F' || buffer[4] != 1 || buffer[5] != 1)
+    return false;
+
+  const auto get16 = [&](size_t offset) -> uInt32 {
+    return offset + 2 <= size ? buffer[offset] | (buffer[offset + 1] << 8) : 0;
+  };
+  const auto get32 = [&](size_t offset) -> uInt32 {
+    return offset + 4 <= size ? get16(offset) | (get16(offset + 2) << 16) : 0;
+  };
+
+  const uInt32 shOffset = get32(0x20), shEntrySize = get16(0x2E), shCount = get16(0x30);
+  if(shEntrySize < 40)
+    return true;
+
+  for(uInt32 i = 0; i < shCount; ++i)
+  {
+    const size_t header = shOffset + size_t(i) * shEntrySize;
+
+    if(get32(header + 4) != 2)  // SHT_SYMTAB
+      continue;
+
+    const size_t symOffset = get32(header + 16), symSize = get32(header + 20);
+    const size_t strHeader = shOffset + size_t(get32(header + 24)) * shEntrySize;
+    const size_t strOffset = get32(strHeader + 16), strSize = get32(strHeader + 20);
+
+    if(symOffset + symSize > size || strOffset + strSize > size)
+      continue;
+
+    for(size_t sym = symOffset; sym + 16 <= symOffset + symSize; sym += 16)
+    {
+      const uInt32 nameOffset = get32(sym);
+
+      // Only use function symbols (STT_FUNC)
+      if((buffer[sym + 12] & 0x0F) != 2 || nameOffset >= strSize)
+        continue;
+
+      const uInt8* strings = &buffer[strOffset];
+      const uInt8* name = strings + nameOffset;
+      const uInt8* nameEnd = std::find(name, strings + strSize, 0);
+
+      if(nameEnd != name)
+        mySymbols.push_back({ get32(sym + 4) & ~1U, get32(sym + 8),
+                              string(reinterpret_cast<const char*>(name), nameEnd - name) });
+    }
+  }
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ThumbulatorProfiler::loadTextSymbols(const ByteBuffer& buffer, size_t size)
+{
+  istringstream in(string(reinterpret_cast<const char*>(buffer.get()), size));
+  string line;
+
+  while(std::getline(in, line))
+  {
+    // Accept 'address name' and 'address type name' lines, ignore all others
+    istringstream tokens(line);
+    vector<string> token;
+    string t;
+
+    while(tokens >> t)
+      token.push_back(t);
+
+    if(token.size() == 3)
+    {
+      // Only use code symbols of 'nm' output
+      if(token[1] != "T" && token[1] != "t")
+        continue;
+    }
+    else if(token.size() != 2)
+      continue;
+
+    const string& name = token.back();
+    char* end = nullptr;
+    const uInt32 address = uInt32(std::strtoul(token[0].c_str(), &end, 16));
+
+    if(*end == 0 && (isalpha(static_cast<unsigned char>(name[0])) || name[0] == '_'))
+      mySymbols.push_back({ address & ~1U, 0, name });
+  }
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int ThumbulatorProfiler::findSymbol(uInt32 address) const
+{
+  const auto it = std::upper_bound(mySymbols.begin(), mySymbols.end(), address,
+      [](uInt32 addr, const Symbol& symbol) { return addr < symbol.address; });
+
+  if(it == mySymbols.begin())
+    return -1;
+
+  const Symbol& symbol = *(it - 1);
+
+  // Without a size, a symbol covers everything up to the next one in its region
+  if(symbol.size ? address < symbol.address + symbol.size
+                 : (symbol.address >> 28) == (address >> 28))
+    return int(it - 1 - mySymbols.begin());
+
+  return -1;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ThumbulatorProfiler::HotSpotList ThumbulatorProfiler::hotSpots(size_t count) const
+{
+  std::map<uInt64, HotSpot> spots;
+
+  for(size_t i = 0; i < myCounters.size(); ++i)
+  {
+    const Counter& counter = myCounters[i];
+
+    if(counter.instructions == 0)
+      continue;
+
+    const uInt32 offset = uInt32(i << 1);
+    const uInt32 address = offset < myRomSize ? offset : 0x40000000 + offset - myRomSize;
+    const int symbol = findSymbol(address);
+    const uInt64 key = symbol >= 0 ? (1ULL << 32) | uInt32(symbol)
+                                   : address & ~(RANGE_SIZE - 1);
+    HotSpot& spot = spots[key];
+
+    if(spot.instructions == 0)
+    {
+      spot.address = symbol >= 0 ? mySymbols[symbol].address : uInt32(key);
+      if(symbol >= 0)
+        spot.name = mySymbols[symbol].name;
+    }
+    spot.instructions += counter.instructions;
+    spot.cycles += counter.cycles;
+  }
+
+  HotSpotList list;
+  list.reserve(spots.size());
+  for(auto& spot: spots)
+    list.push_back(std::move(spot.second));
+
+  std::sort(list.begin(), list.end(),
+      [](const HotSpot& a, const HotSpot& b) { return a.cycles > b.cycles; });
+  if(list.size() > count)
+    list.resize(count);
+
+  return list;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 ThumbulatorProfiler::totalInstructions() const
+{
+  uInt64 total = 0;
+
+  for(const auto& counter: myCounters)
+    total += counter.instructions;
+
+  return total;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 ThumbulatorProfiler::totalCycles() const
+{
+  uInt64 total = 0;
+
+  for(const auto& counter: myCounters)
+    total += counter.cycles;
+
+  return total;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string ThumbulatorProfiler::toString(const HotSpot& hotSpot, uInt64 total)
+{
+  ostringstream buf;
+
+  buf << std::fixed << std::setprecision(1) << std::setw(5)
+      << (total ? 100.0 * hotSpot.cycles / total : 0.0) << "% "
+      << std::setw(10) << hotSpot.cycles << " "
+      << std::setw(10) << hotSpot.instructions << "  "
+      << Base::HEX8 << hotSpot.address << std::dec << std::setfill(' ') << " "
+      << (hotSpot.name.empty() ? "-" : hotSpot.name);
+
+  return buf.str();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string ThumbulatorProfiler::toString(size_t count) const
+{
+  ostringstream buf;
+  const uInt64 total = totalCycles();
+
+  buf << "ARM profile: " << totalInstructions() << " instructions, "
+      << total << " memory cycles, " << mySymbols.size() << " symbols" << endl
+      << "     %     cycles     instr.  address  function" << endl;
+  for(const auto& spot: hotSpots(count))
+    buf << toString(spot, total) << endl;
+
+  return buf.str();
+}
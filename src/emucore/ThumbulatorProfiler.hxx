@@ -0,0 +1,166 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef THUMBULATOR_PROFILER_HXX
+#define THUMBULATOR_PROFILER_HXX
+
+class FilesystemNode;
+
+#include "bspf.hxx"
+
+/**
+  Execution profiler for the ARM code of Thumbulator based carts.
+
+  The Thumbulator reports each executed instruction together with the
+  memory cycles (fetches, reads and writes) it caused.  These are counted
+  per instruction address and can be summed up per function, when symbols
+  were loaded from an ELF or a map file, or else per fixed size address
+  range.
+*/
+class ThumbulatorProfiler
+{
+  public:
+    // The size of the address ranges used for code without symbols
+    static constexpr uInt32 RANGE_SIZE = 64;
+
+    struct HotSpot {
+      uInt32 address{0};        // start of the function or address range
+      string name;              // the function name, empty for address ranges
+      uInt64 instructions{0};
+      uInt64 cycles{0};
+    };
+    using HotSpotList = std::vector<HotSpot>;
+
+    /**
+      Create a new profiler for the given ROM and RAM sizes.
+
+      @param romSize  The size of the ARM ROM (flash), mapped at 0x00000000
+      @param ramSize  The size of the ARM RAM, mapped at 0x40000000
+    */
+    ThumbulatorProfiler(uInt32 romSize, uInt32 ramSize);
+    ~ThumbulatorProfiler() = default;
+
+    /**
+      Count an executed instruction.
+
+      @param address  The address of the instruction
+      @param cycles   The memory cycles caused by the instruction
+    */
+    void count(uInt32 address, uInt32 cycles) {
+      uInt32 offset;
+
+      if(address < myRomSize)
+        offset = address;
+      else if(address - 0x40000000 < myRamSize)
+        offset = myRomSize + address - 0x40000000;
+      else
+        return;
+
+      Counter& counter = myCounters[offset >> 1];
+      ++counter.instructions;
+      counter.cycles += cycles;
+    }
+
+    /**
+      Clear all counters.  Loaded symbols are kept.
+    */
+    void reset();
+
+    /**
+      Load function symbols, either from an ARM ELF file or from a text file
+      with one 'address [type] name' entry per line (e.g. 'nm' output or the
+      symbol list of a linker map file).
+
+      @param node  The file to load the symbols from
+      @return  The number of symbols loaded, zero on any errors
+    */
+    size_t loadSymbols(const FilesystemNode& node);
+
+    /**
+      Load the symbols from an ELF or map file located next to the ROM, if
+      one exists (e.g. 'game.elf' or 'game.map' for 'game.bin').
+
+      @param romFile  The ROM file
+      @return  The number of symbols loaded
+    */
+    size_t loadSymbolsFor(const FilesystemNode& romFile);
+
+    /**
+      Get the functions or address ranges with the most memory cycles.
+
+      @param count  The maximum number of entries to return
+      @return  The hot spots, sorted by descending cycles
+    */
+    HotSpotList hotSpots(size_t count) const;
+
+    uInt64 totalInstructions() const;
+    uInt64 totalCycles() const;
+    size_t symbolCount() const { return mySymbols.size(); }
+
+    /**
+      Format a hot spot as a line of text.
+
+      @param hotSpot  The hot spot to format
+      @param total    The total cycles, used to calculate the percentage
+    */
+    static string toString(const HotSpot& hotSpot, uInt64 total);
+
+    /**
+      Create a report of the hot spots, e.g. for console output.
+
+      @param count  The maximum number of hot spots listed
+    */
+    string toString(size_t count) const;
+
+  private:
+    struct Counter {
+      uInt64 instructions{0};
+      uInt64 cycles{0};
+    };
+
+    struct Symbol {
+      uInt32 address{0};
+      uInt32 size{0};           // zero if unknown
+      string name;
+    };
+
+    bool loadElfSymbols(const ByteBuffer& buffer, size_t size);
+    bool loadTextSymbols(const ByteBuffer& buffer, size_t size);
+
+    // Get the index of the symbol covering the address, or -1 if none
+    int findSymbol(uInt32 address) const;
+
+  private:
+    uInt32 myRomSize{0};
+    uInt32 myRamSize{0};
+
+    // One counter per halfword of ROM, followed by RAM
+    vector<Counter> myCounters;
+
+    // The function symbols, sorted by address
+    vector<Symbol> mySymbols;
+
+  private:
+    // Following constructors and assignment operators not supported
+    ThumbulatorProfiler() = delete;
+    ThumbulatorProfiler(const ThumbulatorProfiler&) = delete;
+    ThumbulatorProfiler(ThumbulatorProfiler&&) = delete;
+    ThumbulatorProfiler& operator=(const ThumbulatorProfiler&) = delete;
+    ThumbulatorProfiler& operator=(ThumbulatorProfiler&&) = delete;
+};
+
+#endif
@@ -2,6 +2,7 @@ MODULE := src/emucore
 
 MODULE_OBJS := \
         src/emucore/AtariVox.o \
+        src/emucore/AutodetectCache.o \
         src/emucore/Bankswitch.o \
         src/emucore/Booster.o \
         src/emucore/Cart.o \
@@ -83,13 +84,16 @@ MODULE_OBJS := \
         src/emucore/Props.o \
         src/emucore/PropsSet.o \
         src/emucore/QuadTari.o \
+        src/emucore/RomCache.o \
         src/emucore/SaveKey.o \
         src/emucore/Serializer.o \
         src/emucore/Settings.o \
+        src/emucore/SignatureIndex.o \
         src/emucore/Switches.o \
         src/emucore/System.o \
         src/emucore/TIASurface.o \
-        src/emucore/Thumbulator.o
+        src/emucore/Thumbulator.o \
+        src/emucore/ThumbulatorProfiler.o
 
 MODULE_DIRS += \
         src/emucore
@@ -107,6 +107,9 @@ void Audio::addSample(uInt8 sample0, uInt8 sample1)
 
   if(++mySampleIndex == myAudioQueue->fragmentSize()) {
     mySampleIndex = 0;
+    if(myFragmentCallback)
+      myFragmentCallback(myCurrentFragment, myAudioQueue->fragmentSize(),
+                         myAudioQueue->isStereo());
     myCurrentFragment = myAudioQueue->enqueue(myCurrentFragment);
   }
 }
@@ -20,12 +20,22 @@
 
 class AudioQueue;
 
+#include <functional>
+
 #include "bspf.hxx"
 #include "AudioChannel.hxx"
 #include "Serializable.hxx"
 
 class Audio : public Serializable
 {
+  public:
+    /**
+      Receives each completed fragment before it is handed to the audio queue.
+      The sample count is in stereo / mono samples, as with the queue.
+    */
+    using FragmentCallback =
+      std::function<void(const Int16* fragment, uInt32 samples, bool isStereo)>;
+
   public:
     Audio();
 
@@ -33,6 +43,8 @@ class Audio : public Serializable
 
     void setAudioQueue(const shared_ptr<AudioQueue>& queue);
 
+    void setFragmentCallback(const FragmentCallback& callback) { myFragmentCallback = callback; }
+
     void tick();
 
     AudioChannel& channel0();
@@ -62,6 +74,8 @@ class Audio : public Serializable
 
     Int16* myCurrentFragment{nullptr};
     uInt32 mySampleIndex{0};
+
+    FragmentCallback myFragmentCallback{nullptr};
   #ifdef GUI_SUPPORT
     mutable ByteArray mySamples;
   #endif
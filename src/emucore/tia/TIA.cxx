@@ -166,6 +166,8 @@ void TIA::initialize()
 #ifdef DEBUGGER_SUPPORT
   myCyclesAtFrameStart = 0;
   myFrameWsyncCycles = 0;
+  myLineWsyncCycles.fill(NO_WSYNC);
+  myLastFrameLineWsyncCycles.fill(NO_WSYNC);
 #endif
 
   if (myFrameManager)
@@ -183,9 +185,9 @@ void TIA::initialize()
   applyDeveloperSettings();
 
   // Must be done last, after all other items have reset
-  bool devSettings = mySettings.getBool("dev.settings");
-  setFixedColorPalette(mySettings.getString("tia.dbgcolors"));
-  enableFixedColors(mySettings.getBool(devSettings ? "dev.debugcolors" : "plr.debugcolors"));
+  const bool devSettings = mySettings.devSettings.get();
+  setFixedColorPalette(mySettings.dbgColors.get());
+  enableFixedColors(mySettings.debugColors[devSettings].get());
 
 #ifdef DEBUGGER_SUPPORT
   createAccessArrays();
@@ -513,8 +515,16 @@ bool TIA::poke(uInt16 address, uInt8 value)
   switch (address)
   {
     case WSYNC:
+    {
+    #ifdef DEBUGGER_SUPPORT
+      const uInt32 line = scanlines();
+
+      if(line < MAX_WSYNC_LINES && myLineWsyncCycles[line] == NO_WSYNC)
+        myLineWsyncCycles[line] = uInt8(myHctr / TIAConstants::CYCLE_CLOCKS);
+    #endif
       mySystem->m6502().requestHalt();
       break;
+    }
 
     case RSYNC:
       flushLineCache();
@@ -918,31 +928,32 @@ bool TIA::loadDisplay(Serializer& in)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::applyDeveloperSettings()
 {
-  bool devSettings = mySettings.getBool("dev.settings");
+  const bool devSettings = mySettings.devSettings.get();
   if(devSettings)
   {
-    bool custom = BSPF::equalsIgnoreCase("custom", mySettings.getString("dev.tia.type"));
+    const string& type = mySettings.tiaType.get();
+    const bool custom = BSPF::equalsIgnoreCase("custom", type);
 
     setPlInvertedPhaseClock(custom
-                            ? mySettings.getBool("dev.tia.plinvphase")
-                            : BSPF::equalsIgnoreCase("koolaidman", mySettings.getString("dev.tia.type")));
+                            ? mySettings.plInvPhase.get()
+                            : BSPF::equalsIgnoreCase("koolaidman", type));
     setMsInvertedPhaseClock(custom
-                            ? mySettings.getBool("dev.tia.msinvphase")
-                            : BSPF::equalsIgnoreCase("cosmicark", mySettings.getString("dev.tia.type")));
-    setBlInvertedPhaseClock(custom ? mySettings.getBool("dev.tia.blinvphase") : false);
+                            ? mySettings.msInvPhase.get()
+                            : BSPF::equalsIgnoreCase("cosmicark", type));
+    setBlInvertedPhaseClock(custom ? mySettings.blInvPhase.get() : false);
     setPFBitsDelay(custom
-                   ? mySettings.getBool("dev.tia.delaypfbits")
-                   : BSPF::equalsIgnoreCase("pesco", mySettings.getString("dev.tia.type")));
+                   ? mySettings.delayPFBits.get()
+                   : BSPF::equalsIgnoreCase("pesco", type));
     setPFColorDelay(custom
-                    ? mySettings.getBool("dev.tia.delaypfcolor")
-                    : BSPF::equalsIgnoreCase("quickstep", mySettings.getString("dev.tia.type")));
+                    ? mySettings.delayPFColor.get()
+                    : BSPF::equalsIgnoreCase("quickstep", type));
     setBKColorDelay(custom
-                    ? mySettings.getBool("dev.tia.delaybkcolor")
-                    : BSPF::equalsIgnoreCase("indy500", mySettings.getString("dev.tia.type")));
+                    ? mySettings.delayBKColor.get()
+                    : BSPF::equalsIgnoreCase("indy500", type));
     setPlSwapDelay(custom
-                   ? mySettings.getBool("dev.tia.delayplswap")
-                   : BSPF::equalsIgnoreCase("heman", mySettings.getString("dev.tia.type")));
-    setBlSwapDelay(custom ? mySettings.getBool("dev.tia.delayblswap") : false);
+                   ? mySettings.delayPlSwap.get()
+                   : BSPF::equalsIgnoreCase("heman", type));
+    setBlSwapDelay(custom ? mySettings.delayBlSwap.get() : false);
   }
   else
   {
@@ -956,13 +967,38 @@ void TIA::applyDeveloperSettings()
     setBlSwapDelay(false);
   }
 
-  myTIAPinsDriven = devSettings ? mySettings.getBool("dev.tiadriven") : false;
+  myTIAPinsDriven = devSettings ? mySettings.tiaDriven.get() : false;
 
-  myEnableJitter = mySettings.getBool(devSettings ? "dev.tv.jitter" : "plr.tv.jitter");
-  myJitterFactor = mySettings.getInt(devSettings ? "dev.tv.jitter_recovery" : "plr.tv.jitter_recovery");
+  myEnableJitter = mySettings.jitter[devSettings].get();
+  myJitterFactor = mySettings.jitterRecovery[devSettings].get();
 
   if(myFrameManager)
-    enableColorLoss(mySettings.getBool(devSettings ? "dev.colorloss" : "plr.colorloss"));
+    enableColorLoss(mySettings.colorLoss[devSettings].get());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+TIA::SettingHandles::SettingHandles(const Settings& settings)
+  : devSettings{settings.handle<bool>("dev.settings")},
+    dbgColors{settings.handle<string>("tia.dbgcolors")},
+    tiaType{settings.handle<string>("dev.tia.type")},
+    plInvPhase{settings.handle<bool>("dev.tia.plinvphase")},
+    msInvPhase{settings.handle<bool>("dev.tia.msinvphase")},
+    blInvPhase{settings.handle<bool>("dev.tia.blinvphase")},
+    delayPFBits{settings.handle<bool>("dev.tia.delaypfbits")},
+    delayPFColor{settings.handle<bool>("dev.tia.delaypfcolor")},
+    delayBKColor{settings.handle<bool>("dev.tia.delaybkcolor")},
+    delayPlSwap{settings.handle<bool>("dev.tia.delayplswap")},
+    delayBlSwap{settings.handle<bool>("dev.tia.delayblswap")},
+    tiaDriven{settings.handle<bool>("dev.tiadriven")},
+    debugColors{{settings.handle<bool>("plr.debugcolors"),
+                 settings.handle<bool>("dev.debugcolors")}},
+    jitter{{settings.handle<bool>("plr.tv.jitter"),
+            settings.handle<bool>("dev.tv.jitter")}},
+    colorLoss{{settings.handle<bool>("plr.colorloss"),
+               settings.handle<bool>("dev.colorloss")}},
+    jitterRecovery{{settings.handle<int>("plr.tv.jitter_recovery"),
+                    settings.handle<int>("dev.tv.jitter_recovery")}}
+{
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1345,6 +1381,8 @@ void TIA::onFrameComplete()
   mySystem->m6502().stop();
 #ifdef DEBUGGER_SUPPORT
   myCyclesAtFrameStart = mySystem->cycles();
+  myLastFrameLineWsyncCycles = myLineWsyncCycles;
+  myLineWsyncCycles.fill(NO_WSYNC);
 #endif
 
   if (myXAtRenderingStart > 0)
@@ -1360,6 +1398,9 @@ void TIA::onFrameComplete()
   myFrontBufferScanlines = scanlinesLastFrame();
 
   ++myFramesSinceLastRender;
+
+  if(myFrameCallback)
+    myFrameCallback(myFrontBuffer.data(), height());
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
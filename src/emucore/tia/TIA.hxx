@@ -104,6 +104,7 @@ class TIA : public Device
     };
 
     using ConsoleTimingProvider = std::function<ConsoleTiming()>;
+    using FrameCallback = std::function<void(const uInt8* frame, uInt32 height)>;
 
   public:
     friend class TIADebug;
@@ -131,6 +132,21 @@ class TIA : public Device
     */
     void setAudioQueue(const shared_ptr<AudioQueue>& audioQueue);
 
+    /**
+      Set a callback that receives every completed frame (as color indices),
+      independent of whether the frame is actually rendered. The callback is
+      invoked on the emulation thread; pass nullptr to remove it.
+    */
+    void setFrameCallback(const FrameCallback& callback) { myFrameCallback = callback; }
+
+    /**
+      Set a callback that receives every completed audio fragment (see
+      Audio::setFragmentCallback); pass nullptr to remove it.
+    */
+    void setAudioCallback(const Audio::FragmentCallback& callback) {
+      myAudio.setFragmentCallback(callback);
+    }
+
     /**
       Clear the configured frame manager and deteach the lifecycle callbacks.
      */
@@ -341,6 +357,34 @@ class TIA : public Device
     uInt32 frameWSyncCycles() const {
       return uInt32(myFrameWsyncCycles);
     }
+
+    // Marks scanlines without WSYNC in the per scanline WSYNC data below
+    static constexpr uInt8 NO_WSYNC = 0xff;
+    // The number of scanlines per frame with WSYNC data
+    static constexpr uInt32 MAX_WSYNC_LINES = 512;
+
+    /**
+      Answers the CPU cycles used on the given scanline before WSYNC was
+      written, or NO_WSYNC if there was no WSYNC on that line.  Scanlines
+      not yet reached in the current frame are taken from the previous frame.
+
+      @param line  The scanline, counted from the start of the frame
+    */
+    uInt8 scanlineWsyncCycles(uInt32 line) const {
+      if(line >= MAX_WSYNC_LINES)
+        return NO_WSYNC;
+
+      return line < scanlines() ? myLineWsyncCycles[line]
+                                : myLastFrameLineWsyncCycles[line];
+    }
+
+    /**
+      Answers the CPU cycles used before WSYNC on each scanline of the
+      previous frame (see scanlineWsyncCycles()).
+    */
+    const std::array<uInt8, MAX_WSYNC_LINES>& lastFrameWsyncCycles() const {
+      return myLastFrameLineWsyncCycles;
+    }
   #endif // DEBUGGER_SUPPORT
 
     /**
@@ -746,7 +790,26 @@ class TIA : public Device
   private:
     ConsoleIO& myConsole;
     ConsoleTimingProvider myTimingProvider;
-    Settings& mySettings;
+
+    /**
+     * Handles to the settings applied on each reset.  Settings which exist
+     * for both the player and the developer are kept as {plr, dev} pairs,
+     * indexed by the value of 'dev.settings'.
+     */
+    struct SettingHandles {
+      explicit SettingHandles(const Settings& settings);
+
+      Settings::Handle<bool> devSettings;
+      Settings::Handle<string> dbgColors;
+      Settings::Handle<string> tiaType;
+      Settings::Handle<bool> plInvPhase, msInvPhase, blInvPhase;
+      Settings::Handle<bool> delayPFBits, delayPFColor, delayBKColor;
+      Settings::Handle<bool> delayPlSwap, delayBlSwap;
+      Settings::Handle<bool> tiaDriven;
+      std::array<Settings::Handle<bool>, 2> debugColors, jitter, colorLoss;
+      std::array<Settings::Handle<int>, 2> jitterRecovery;
+    };
+    SettingHandles mySettings;
 
     /**
      * The length of the delay queue (maximum number of clocks delay)
@@ -819,6 +882,9 @@ class TIA : public Device
     // Frames since the last time a frame was rendered to the render buffer
     uInt32 myFramesSinceLastRender{0};
 
+    // Optional receiver of all completed frames (e.g. video recording)
+    FrameCallback myFrameCallback{nullptr};
+
     /**
      * Setting this to true injects random values into undefined reads.
      */
@@ -953,6 +1019,13 @@ class TIA : public Device
      * System cycles used by WSYNC during current frame.
      */
     uInt64 myFrameWsyncCycles{0};
+
+    /**
+     * CPU cycles used before WSYNC on each scanline of the current and the
+     * previous frame, NO_WSYNC for scanlines without WSYNC.
+     */
+    std::array<uInt8, MAX_WSYNC_LINES> myLineWsyncCycles;
+    std::array<uInt8, MAX_WSYNC_LINES> myLastFrameLineWsyncCycles;
   #endif // DEBUGGER_SUPPORT
 
     /**
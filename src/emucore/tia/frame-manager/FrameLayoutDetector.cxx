@@ -32,6 +32,11 @@ enum Metrics: uInt32 {
   // tolerance window around ideal frame size for TV mode detection
   tvModeDetectionTolerance  = 20,
 
+  // number of consecutive, similar frames required for a final result, and the
+  // maximum difference in scanlines between these frames
+  stableFrames              = 10,
+  stableFrameTolerance      = 2,
+
   // these frames will not be considered for detection
   initialGarbageFrames      = TIAConstants::initialGarbageFrames
 };
@@ -42,6 +47,12 @@ FrameLayout FrameLayoutDetector::detectedLayout() const{
   return myPalFrames > myNtscFrames ? FrameLayout::pal : FrameLayout::ntsc;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 FrameLayoutDetector::confidence() const
+{
+  return std::min(myStableFrames * 100 / Metrics::stableFrames, 100U);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 FrameLayoutDetector::FrameLayoutDetector()
 {
@@ -53,6 +64,7 @@ void FrameLayoutDetector::onReset()
 {
   myState = State::waitForVsyncStart;
   myNtscFrames = myPalFrames = 0;
+  myStableFrames = myLastFrameLines = 0;
   myLinesWaitingForVsyncToStart = 0;
 }
 
@@ -127,7 +139,8 @@ void FrameLayoutDetector::finalizeFrame()
     deltaPAL =  abs(Int32(myCurrentFrameFinalLines) - Int32(frameLinesPAL));
 
   // Does the scanline count fall into one of our tolerance windows? -> use it
-  if (std::min(deltaNTSC, deltaPAL) <= Metrics::tvModeDetectionTolerance)
+  const bool inWindow = std::min(deltaNTSC, deltaPAL) <= Metrics::tvModeDetectionTolerance;
+  if (inWindow)
     layout(deltaNTSC <= deltaPAL ? FrameLayout::ntsc : FrameLayout::pal);
   else if (
   // If scanline count is odd and lies between the PAL and NTSC windows we assume
@@ -153,4 +166,18 @@ void FrameLayoutDetector::finalizeFrame()
     default:
       throw runtime_error("cannot happen");
   }
+
+  // Only proper frames count as stable, and only if they also agree with the
+  // majority, otherwise the result could still change
+  const bool similar =
+    abs(Int32(myCurrentFrameFinalLines) - Int32(myLastFrameLines)) <= Metrics::stableFrameTolerance;
+
+  if (!inWindow || layout() != detectedLayout())
+    myStableFrames = 0;
+  else if (similar && myStableFrames > 0)
+    ++myStableFrames;
+  else
+    myStableFrames = 1;
+
+  myLastFrameLines = myCurrentFrameFinalLines;
 }
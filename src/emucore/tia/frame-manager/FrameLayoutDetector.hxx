@@ -37,6 +37,14 @@ class FrameLayoutDetector: public AbstractFrameManager {
      */
     FrameLayout detectedLayout() const;
 
+    /**
+     * Return the confidence in the detected frame layout, in percent. This is
+     * a stability heuristic, based on the number of consecutive frames with a
+     * similar line count which agree with the majority. At 100 callers may stop
+     * running frames, although later frames could still flip the majority vote.
+     */
+    uInt32 confidence() const;
+
   protected:
 
     /**
@@ -92,6 +100,12 @@ class FrameLayoutDetector: public AbstractFrameManager {
      */
     uInt32 myNtscFrames{0}, myPalFrames{0};
 
+    /**
+     * The number of consecutive frames with the same layout and a similar
+     * scanline count, and the scanline count of the last frame.
+     */
+    uInt32 myStableFrames{0}, myLastFrameLines{0};
+
     /**
      * We count the number of scanlines we spend waiting for vsync to be
      * toggled. If a threshold is exceeded, we force the transition.
@@ -21,6 +21,7 @@
 #include "FileListWidget.hxx"
 #include "TimerManager.hxx"
 #include "ProgressDialog.hxx"
+#include "DirectoryScanner.hxx"
 
 #include "bspf.hxx"
 
@@ -84,10 +85,16 @@ void FileListWidget::setLocation(const FilesystemNode& node,
   // Read in the data from the file system (start with an empty list)
   _fileList.clear();
 
-  if(_includeSubDirs)
+  if(_includeSubDirs && BSPF::findIgnoreCase(_node.getPath(), ".zip") == string::npos)
   {
     // Actually this could become HUGE
     _fileList.reserve(0x2000);
+    scanSubDirs(select, isCancelled);
+  }
+  else if(_includeSubDirs)
+  {
+    // ZIP archives can't be scanned in the background
+    _fileList.reserve(0x2000);
     _node.getAllChildren(_fileList, _fsmode, _filter, true, isCancelled);
   }
   else
@@ -98,6 +105,45 @@ void FileListWidget::setLocation(const FilesystemNode& node,
 
   // Now fill the list widget with the names from the file list,
   // even if cancelled
+  fillList(select);
+
+  progress().close();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FileListWidget::scanSubDirs(const string& select,
+                                 const FilesystemNode::CancelCheck& isCancelled)
+{
+  if(_node.hasParent())
+  {
+    FilesystemNode parent = _node.getParent();
+    parent.setName(" [..]");
+    _fileList.emplace_back(parent);
+  }
+
+  // The subdirectories are read in the background, while the files found
+  // so far are already shown
+  DirectoryScanner scanner(_node);
+  uInt64 refreshTime = 0;
+
+  while(scanner.collect(_fileList, _filter, SCAN_WAIT))
+  {
+    if(isCancelled())
+      break;
+
+    const uInt64 time = TimerManager::getTicks() / 1000;
+    if(time >= refreshTime)
+    {
+      fillList(select);
+      progress().refresh();
+      refreshTime = time + SCAN_REFRESH;
+    }
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FileListWidget::fillList(const string& select)
+{
   StringList l;
   size_t orgLen = _node.getShortPath().length();
 
@@ -117,8 +163,6 @@ void FileListWidget::setLocation(const FilesystemNode& node,
   setList(l);
   setSelected(select);
   ListWidget::recalc();
-
-  progress().close();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -87,6 +87,7 @@ class FileListWidget : public StringListWidget
       return _fileList[_selected];
     }
     const FilesystemNode& currentDir() const { return _node; }
+    const FSList& fileList() const { return _fileList; }
 
     static void setQuickSelectDelay(uInt64 time) { _QUICK_SELECT_DELAY = time; }
     uInt64 getQuickSelectDelay() const { return _QUICK_SELECT_DELAY; }
@@ -104,6 +105,13 @@ class FileListWidget : public StringListWidget
     /** Descend into currently selected directory */
     void selectDirectory();
 
+    /** Add the files of the current location and all its subdirectories */
+    void scanSubDirs(const string& select,
+                     const FilesystemNode::CancelCheck& isCancelled);
+
+    /** Fill the list widget with the names from the file list */
+    void fillList(const string& select);
+
     bool handleText(char text) override;
     void handleCommand(CommandSender* sender, int cmd, int data, int id) override;
 
@@ -124,6 +132,11 @@ class FileListWidget : public StringListWidget
     uInt64 _quickSelectTime{0};
     static uInt64 _QUICK_SELECT_DELAY;
 
+    // Time (in ms) to wait for new files when scanning subdirectories
+    static constexpr uInt32 SCAN_WAIT = 50;
+    // Minimum time (in ms) between list updates while scanning
+    static constexpr uInt64 SCAN_REFRESH = 250;
+
   private:
     // Following constructors and assignment operators not supported
     FileListWidget() = delete;
@@ -24,7 +24,6 @@
 #include "EditTextWidget.hxx"
 #include "FileListWidget.hxx"
 #include "FSNode.hxx"
-#include "MD5.hxx"
 #include "OptionsDialog.hxx"
 #include "HighScoresDialog.hxx"
 #include "HighScoresManager.hxx"
@@ -295,6 +294,8 @@ LauncherDialog::LauncherDialog(OSystem& osystem, DialogContainer& parent,
 
   addToFocusList(wid);
 
+  myRomIndexer = make_unique<RomIndexer>(instance());
+
   // since we cannot know how many files there are, use are really high value here
   myList->progress().setRange(0, 50000, 5);
   myList->progress().setMessage("        Filtering files" + ELLIPSIS + "        ");
@@ -318,16 +319,11 @@ const string& LauncherDialog::selectedRomMD5()
   if(currentNode().isDirectory() || !Bankswitch::isValidRomName(currentNode()))
     return EmptyString;
 
-  // Attempt to conserve memory
-  if(myMD5List.size() > 500)
-    myMD5List.clear();
-
-  // Lookup MD5, and if not present, cache it
-  auto iter = myMD5List.find(currentNode().getPath());
-  if(iter == myMD5List.end())
-    myMD5List[currentNode().getPath()] = MD5::hash(currentNode());
+  // Lookup MD5 in the ROM index; if not present, the ROM is indexed now
+  if(!myRomIndexer->get(currentNode(), mySelectedEntry))
+    return EmptyString;
 
-  return myMD5List[currentNode().getPath()];
+  return mySelectedEntry.md5;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -345,9 +341,12 @@ const FilesystemNode& LauncherDialog::currentDir() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void LauncherDialog::reload()
 {
-  myMD5List.clear();
   myList->reload();
   myPendingReload = false;
+
+  // The filters may have changed the listing
+  myIndexedDir = EmptyString;
+  indexRoms();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -365,6 +364,8 @@ void LauncherDialog::tick()
   if(myPendingReload && myReloadTime < TimerManager::getTicks() / 1000)
     reload();
 
+  myRomIndexer->update();
+
   Dialog::tick();
 }
 
@@ -403,7 +404,7 @@ void LauncherDialog::loadConfig()
   Dialog::setFocus(getFocusList()[mySelectedItem]);
 
   if(myRomInfoWidget)
-    myRomInfoWidget->reloadProperties(currentNode());
+    myRomInfoWidget->reloadProperties();
 
   myList->clearFlags(Widget::FLAG_WANTS_RAWDATA); // always reset this
 }
@@ -432,6 +433,9 @@ void LauncherDialog::updateUI()
   buf << (myList->getList().size() - 1) << (myShortCount ? " found" : " items found");
   myRomCount->setLabel(buf.str());
 
+  // Start indexing a new listing before the ROM info needs it
+  indexRoms();
+
   // Update ROM info UI item
   loadRomInfo();
 }
@@ -606,11 +610,22 @@ void LauncherDialog::loadRomInfo()
 
   const string& md5 = selectedRomMD5();
   if(md5 != EmptyString)
-    myRomInfoWidget->setProperties(currentNode(), md5);
+    myRomInfoWidget->setProperties(currentNode(), mySelectedEntry);
   else
     myRomInfoWidget->clearProperties();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void LauncherDialog::indexRoms()
+{
+  // Index all ROMs of a new directory listing in the background
+  if(myIndexedDir != currentDir().getPath())
+  {
+    myIndexedDir = currentDir().getPath();
+    myRomIndexer->index(myList->fileList());
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void LauncherDialog::handleContextMenu()
 {
@@ -35,11 +35,10 @@ namespace GUI {
   class MessageBox;
 }
 
-#include <unordered_map>
-
 #include "bspf.hxx"
 #include "Dialog.hxx"
 #include "FSNode.hxx"
+#include "RomIndexer.hxx"
 
 class LauncherDialog : public Dialog
 {
@@ -150,6 +149,7 @@ class LauncherDialog : public Dialog
 
     void loadRom();
     void loadRomInfo();
+    void indexRoms();
     void handleContextMenu();
     void showOnlyROMs(bool state);
     void setDefaultDir();
@@ -183,7 +183,12 @@ class LauncherDialog : public Dialog
     ButtonWidget*     myQuitButton{nullptr};
 
     RomInfoWidget*    myRomInfoWidget{nullptr};
-    std::unordered_map<string,string> myMD5List;
+
+    // Index of the ROMs in the current listing, and the entry of the selected ROM
+    unique_ptr<RomIndexer> myRomIndexer;
+    RomIndexer::Entry mySelectedEntry;
+    // The directory whose ROMs are currently indexed in the background
+    string myIndexedDir;
 
     int mySelectedItem{0};
 
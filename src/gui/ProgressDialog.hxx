@@ -40,6 +40,9 @@ class ProgressDialog : public Dialog
     void incProgress();
     bool isCancelled() const { return myIsCancelled; }
 
+    // Redraw the screen and handle pending events (e.g. the cancel button)
+    void refresh();
+
   private:
     const GUI::Font& myFont;
     StaticTextWidget* myMessage{nullptr};
@@ -31,8 +31,95 @@
 #include "Props.hxx"
 #include "PropsSet.hxx"
 #include "Settings.hxx"
+#include "WorkerPool.hxx"
 #include "RomAuditDialog.hxx"
 
+namespace {
+  // Number of files read before their MD5s are calculated together
+  constexpr uInt32 AUDIT_BATCH = 16;
+
+  // Maximum number of threads reading and hashing files
+  constexpr uInt32 MAX_THREADS = 16;
+
+  // The results for the files [first, first + md5s.size())
+  struct Batch {
+    uInt32 first{0};
+    StringList extensions;  // empty if not a ROM file
+    StringList md5s;        // empty if not a ROM or unreadable
+    BoolArray zipped;       // ROM must be read by the collecting thread
+  };
+
+  /**
+    Read and hash the ROMs in a batch of files; this runs on a worker
+    thread.  Everything else (properties lookup, renaming) is left to the
+    thread collecting the results.
+
+    Files in ZIP archives are not read here, since ZipHandler is not
+    thread-safe; these are marked as 'zipped' instead, and must be read
+    by the collecting thread.
+
+    @param files  The files to audit
+    @param first  The first file of the batch
+    @return  The results for the batch
+  */
+  Batch hashBatch(const FSList& files, uInt32 first)
+  {
+    Batch batch;
+    batch.first = first;
+
+    const uInt32 count = std::min(AUDIT_BATCH, uInt32(files.size()) - first);
+    batch.extensions.resize(count);
+    batch.zipped.resize(count, false);
+    std::vector<ByteBuffer> images(count);
+    std::vector<size_t> sizes(count, 0);
+    for(uInt32 i = 0; i < count; ++i)
+    {
+      const FilesystemNode& file = files[first + i];
+      if(file.isFile() && Bankswitch::isValidRomName(file, batch.extensions[i]))
+      {
+        if(BSPF::containsIgnoreCase(file.getPath(), ".zip"))
+        {
+          batch.zipped[i] = true;
+          continue;
+        }
+        try
+        {
+          sizes[i] = file.read(images[i]);
+        }
+        catch(...)
+        {
+        }
+      }
+    }
+    batch.md5s = MD5::hash(images, sizes);
+    for(uInt32 i = 0; i < count; ++i)
+      if(sizes[i] == 0)
+        batch.md5s[i] = EmptyString;
+
+    return batch;
+  }
+
+  /**
+    Read and hash a ROM in a ZIP archive.
+
+    @param file  The file in the archive
+    @return  The MD5 of the ROM; empty if it is unreadable
+  */
+  string hashZipped(const FilesystemNode& file)
+  {
+    ByteBuffer image;
+    size_t size = 0;
+    try
+    {
+      size = file.read(image);
+    }
+    catch(...)
+    {
+    }
+    return size > 0 ? MD5::hash(image, size) : EmptyString;
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 RomAuditDialog::RomAuditDialog(OSystem& osystem, DialogContainer& parent,
                                const GUI::Font& font, int max_w, int max_h)
@@ -125,40 +212,64 @@ void RomAuditDialog::auditRoms()
   progress.setRange(0, int(files.size()) - 1, 5);
   progress.open();
 
+  // The files are read and hashed in batches on a pool of threads, while
+  // the results are handled here (in any order)
+  using HashPool = Common::WorkerPool<Batch>;
+  HashPool hasher(HashPool::threadCount(2, MAX_THREADS));
+  for(uInt32 first = 0; first < files.size(); first += AUDIT_BATCH)
+    hasher.submit([&files, first]{ return hashBatch(files, first); });
+  std::vector<Batch> batches;
+
   Properties props;
-  uInt32 renamed = 0, notfound = 0;
-  for(uInt32 idx = 0; idx < files.size() && !progress.isCancelled(); ++idx)
+  uInt32 renamed = 0, notfound = 0, done = 0;
+  while(done < files.size() && !progress.isCancelled())
   {
-    string extension;
-    if(files[idx].isFile() &&
-       Bankswitch::isValidRomName(files[idx], extension))
+    batches.clear();
+    hasher.collect(batches, 50);
+    if(batches.empty())
     {
-      bool renameSucceeded = false;
+      // Keep the dialog responsive (e.g. the cancel button) while waiting
+      progress.refresh();
+      continue;
+    }
 
-      // Calculate the MD5 so we can get the rest of the info
-      // from the PropertiesSet (stella.pro)
-      const string& md5 = MD5::hash(files[idx]);
-      if(instance().propSet().getMD5(md5, props))
+    for(const auto& batch: batches)
+    {
+      for(uInt32 i = 0; i < batch.md5s.size(); ++i)
       {
-        const string& name = props.get(PropType::Cart_Name);
-
-        // Only rename the file if we found a valid properties entry
-        if(name != "" && name != files[idx].getName())
+        FilesystemNode& file = files[batch.first + i];
+        const string& extension = batch.extensions[i];
+        if(!extension.empty())
         {
-          string newfile = node.getPath();
-          newfile.append(name).append(".").append(extension);
-          if(files[idx].getPath() != newfile && files[idx].rename(newfile))
-            renameSucceeded = true;
+          bool renameSucceeded = false;
+
+          // Use the MD5 to get the rest of the info from the PropertiesSet
+          // (stella.pro)
+          const string& md5 = batch.zipped[i] ? hashZipped(file) : batch.md5s[i];
+          if(!md5.empty() && instance().propSet().getMD5(md5, props))
+          {
+            const string& name = props.get(PropType::Cart_Name);
+
+            // Only rename the file if we found a valid properties entry
+            if(name != "" && name != file.getName())
+            {
+              string newfile = node.getPath();
+              newfile.append(name).append(".").append(extension);
+              if(file.getPath() != newfile && file.rename(newfile))
+                renameSucceeded = true;
+            }
+          }
+          if(renameSucceeded)
+            ++renamed;
+          else
+            ++notfound;
         }
+
+        // Update the progress bar, indicating one more ROM has been processed
+        progress.incProgress();
       }
-      if(renameSucceeded)
-        ++renamed;
-      else
-        ++notfound;
+      done += uInt32(batch.md5s.size());
     }
-
-    // Update the progress bar, indicating one more ROM has been processed
-    progress.incProgress();
   }
   progress.close();
 
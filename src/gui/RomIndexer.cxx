@@ -0,0 +1,228 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "OSystem.hxx"
+#include "Bankswitch.hxx"
+#include "CartDetector.hxx"
+#include "ControllerDetector.hxx"
+#include "MD5.hxx"
+#include "SignatureIndex.hxx"
+#include "Version.hxx"
+#include "RomIndexer.hxx"
+
+namespace {
+  // Number of new entries which are stored at once while the worker is busy
+  constexpr size_t SAVE_BATCH = 256;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomIndexer::RomIndexer(OSystem& osystem)
+  : myRepository{osystem.getRomIndexRepository()}
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomIndexer::~RomIndexer()
+{
+  // ROMs still being indexed are dropped when the pool is stopped
+  collect();
+  save();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndexer::index(const FSList& files)
+{
+  load();
+  collect();
+
+  // Entries without a stamp are only valid for the previous listing
+  for(auto iter = myRecords.begin(); iter != myRecords.end(); )
+  {
+    if(iter->second.stamp.empty())
+      iter = myRecords.erase(iter);
+    else
+      ++iter;
+  }
+
+  myPool.clear();
+  for(const auto& file: files)
+  {
+    if(file.isDirectory() || !Bankswitch::isValidRomName(file))
+      continue;
+
+    const auto iter = myRecords.find(file.getPath());
+    const string oldStamp = iter != myRecords.end() ? iter->second.stamp : EmptyString;
+    myPool.submit([this, file, oldStamp]{ return indexFile(file, oldStamp); });
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomIndexer::get(const FilesystemNode& node, Entry& entry)
+{
+  load();
+  collect();
+
+  const string& path = node.getPath();
+  Record record;
+  record.stamp = stamp(node);
+
+  const auto iter = myRecords.find(path);
+  if(iter != myRecords.end() && iter->second.stamp == record.stamp)
+  {
+    entry = iter->second.entry;
+    return true;
+  }
+
+  // Not indexed yet, so do it now
+  if(!analyze(node, record.entry))
+    return false;
+
+  entry = record.entry;
+  if(!record.stamp.empty())
+    myUnsaved[path] = serialize(record);
+  myRecords[path] = std::move(record);
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndexer::update()
+{
+  const bool idle = myPool.isIdle();
+  collect();
+
+  // Store all entries in one transaction, instead of one per ROM
+  if(myUnsaved.size() >= SAVE_BATCH || (idle && !myUnsaved.empty()))
+    save();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndexer::collect()
+{
+  std::vector<Result> results;
+  myPool.collect(results);
+
+  for(auto& result: results)
+  {
+    if(result.first.empty())
+      continue;
+
+    myUnsaved[result.first] = serialize(result.second);
+    myRecords[result.first] = std::move(result.second);
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndexer::load()
+{
+  if(myLoaded)
+    return;
+
+  for(const auto& [path, data]: myRepository->load())
+  {
+    Record record;
+    if(deserialize(data.toString(), record))
+      myRecords.emplace(path, std::move(record));
+  }
+  myLoaded = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomIndexer::save()
+{
+  if(myUnsaved.empty())
+    return;
+
+  myRepository->save(myUnsaved);
+  myUnsaved.clear();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomIndexer::Result RomIndexer::indexFile(const FilesystemNode& node,
+                                         const string& oldStamp) const
+{
+  Result result;
+  result.second.stamp = stamp(node);
+  if(!result.second.stamp.empty() && result.second.stamp != oldStamp &&
+     analyze(node, result.second.entry))
+    result.first = node.getPath();
+
+  return result;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string RomIndexer::stamp(const FilesystemNode& node)
+{
+  // Nodes which can't report their size (e.g. inside ZIP archives) share
+  // the archive handler with the main thread, so they are never stamped
+  const size_t size = node.getSize();
+  if(size == 0)
+    return EmptyString;
+
+  ostringstream buf;
+  buf << node.getLastModified() << ':' << size << ':' << STELLA_VERSION;
+
+  return buf.str();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomIndexer::analyze(const FilesystemNode& node, Entry& entry) const
+{
+  try
+  {
+    ByteBuffer image;
+    const size_t size = node.read(image);
+    if(size == 0)
+      return false;
+
+    entry.md5 = MD5::hash(image, size);
+
+    // All detections search the same index, so the image is scanned once
+    const SignatureIndex index(image, size);
+    entry.bsType = Bankswitch::typeToName(CartDetector::autodetectType(index));
+    entry.leftPort = ControllerDetector::detectName(index,
+        Controller::Type::Unknown, Controller::Jack::Left, myDetectSettings);
+    entry.rightPort = ControllerDetector::detectName(index,
+        Controller::Type::Unknown, Controller::Jack::Right, myDetectSettings);
+
+    return true;
+  }
+  catch(const runtime_error&)
+  {
+    return false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string RomIndexer::serialize(const Record& record)
+{
+  return record.stamp + '\t' + record.entry.md5 + '\t' + record.entry.bsType +
+         '\t' + record.entry.leftPort + '\t' + record.entry.rightPort;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomIndexer::deserialize(const string& data, Record& record)
+{
+  std::istringstream buf(data);
+
+  return std::getline(buf, record.stamp, '\t') &&
+         std::getline(buf, record.entry.md5, '\t') &&
+         std::getline(buf, record.entry.bsType, '\t') &&
+         std::getline(buf, record.entry.leftPort, '\t') &&
+         std::getline(buf, record.entry.rightPort) &&
+         !record.stamp.empty() && !record.entry.md5.empty();
+}
@@ -0,0 +1,166 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef ROM_INDEXER_HXX
+#define ROM_INDEXER_HXX
+
+class OSystem;
+
+#include "bspf.hxx"
+#include "FSNode.hxx"
+#include "Settings.hxx"
+#include "WorkerPool.hxx"
+#include "repository/KeyValueRepository.hxx"
+
+/**
+  This class indexes the ROMs shown in the launcher on a separate thread.
+  For each ROM, the MD5 and the autodetected bankswitch and controller
+  types are determined, so that selecting a ROM doesn't have to read and
+  analyze the file again.
+
+  The index is kept in a persistent repository, keyed by the ROM path.
+  An entry is only used as long as the modification time and size of
+  the file (and the Stella version) match the ones it was created for.
+  Files whose size can't be determined (e.g. inside ZIP archives) are not
+  indexed in the background, but still cached for the current listing.
+*/
+class RomIndexer
+{
+  public:
+    struct Entry {
+      string md5;
+      string bsType;     // autodetected bankswitch type name
+      string leftPort;   // controller autodetected for the left jack
+      string rightPort;  // controller autodetected for the right jack
+    };
+
+    /**
+      The constructor starts the worker thread.
+    */
+    explicit RomIndexer(OSystem& osystem);
+
+    /**
+      The destructor stops the worker thread and stores all new entries.
+    */
+    ~RomIndexer();
+
+    /**
+      Index the given files in the background.  Files which are not valid
+      ROMs or which are indexed already are skipped.  Files still queued
+      from a previous call are dropped.
+
+      @param files  The files of the current launcher listing
+    */
+    void index(const FSList& files);
+
+    /**
+      Get the index entry for the given ROM.  If the ROM has not been
+      indexed yet (or has changed since), it is indexed immediately.
+
+      @param node   The ROM to get the entry for
+      @param entry  Receives the index entry
+
+      @return  False if the ROM couldn't be read, else true
+    */
+    bool get(const FilesystemNode& node, Entry& entry);
+
+    /**
+      Collect the entries created by the worker thread, and store them
+      in the repository once the worker is idle.  Must be called regularly
+      from the main thread.
+    */
+    void update();
+
+  private:
+    struct Record {
+      string stamp;
+      Entry entry;
+    };
+
+    // The path and new record of an indexed ROM (empty path if unchanged
+    // or unreadable)
+    using Result = std::pair<string, Record>;
+
+    /**
+      Index the given ROM on the worker thread, unless it is unchanged.
+
+      @param node      The ROM to index
+      @param oldStamp  The stamp of the existing entry, if any
+    */
+    Result indexFile(const FilesystemNode& node, const string& oldStamp) const;
+
+    /**
+      Move the entries created by the worker thread into the index.
+    */
+    void collect();
+
+    /**
+      Load the stored index from the repository (on first use only).
+    */
+    void load();
+
+    /**
+      Store all entries which were created since the last call.
+    */
+    void save();
+
+    /**
+      Create the stamp identifying the current version of the given file.
+
+      @return  The stamp, or an empty string if it can't be determined
+    */
+    static string stamp(const FilesystemNode& node);
+
+    /**
+      Read the given ROM and determine its index entry.  This can be
+      called from any thread.
+
+      @return  False if the ROM couldn't be read, else true
+    */
+    bool analyze(const FilesystemNode& node, Entry& entry) const;
+
+    static string serialize(const Record& record);
+    static bool deserialize(const string& data, Record& record);
+
+  private:
+    shared_ptr<KeyValueRepositoryAtomic> myRepository;
+
+    // The index, accessed by the main thread only
+    std::unordered_map<string, Record> myRecords;
+    bool myLoaded{false};
+
+    // Entries not yet stored in the repository
+    std::map<string, Variant> myUnsaved;
+
+    // Default settings used for controller autodetection; these are never
+    // changed, so they can be safely used by the worker thread
+    Settings myDetectSettings;
+
+    // The worker thread; declared last, so that it is stopped before the
+    // data used by the tasks is destroyed
+    Common::WorkerPool<Result> myPool{1};
+
+  private:
+    // Following constructors and assignment operators not supported
+    RomIndexer() = delete;
+    RomIndexer(const RomIndexer&) = delete;
+    RomIndexer(RomIndexer&&) = delete;
+    RomIndexer& operator=(const RomIndexer&) = delete;
+    RomIndexer& operator=(RomIndexer&&) = delete;
+};
+
+#endif
@@ -21,10 +21,7 @@
 #include "FBSurface.hxx"
 #include "Font.hxx"
 #include "OSystem.hxx"
-#include "ControllerDetector.hxx"
 #include "Bankswitch.hxx"
-#include "CartDetector.hxx"
-#include "Logger.hxx"
 #include "Props.hxx"
 #include "PNGLibrary.hxx"
 #include "PropsSet.hxx"
@@ -45,19 +42,21 @@ RomInfoWidget::RomInfoWidget(GuiObject* boss, const GUI::Font& font,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void RomInfoWidget::setProperties(const FilesystemNode& node, const string& md5)
+void RomInfoWidget::setProperties(const FilesystemNode& node,
+                                  const RomIndexer::Entry& entry)
 {
   myHaveProperties = true;
+  myRomEntry = entry;
 
   // Make sure to load a per-ROM properties entry, if one exists
-  instance().propSet().loadPerROM(node, md5);
+  instance().propSet().loadPerROM(node, entry.md5);
 
   // And now get the properties for this ROM
-  instance().propSet().getMD5(md5, myProperties);
+  instance().propSet().getMD5(entry.md5, myProperties);
 
   // Decide whether the information should be shown immediately
   if(instance().eventHandler().state() == EventHandlerState::LAUNCHER)
-    parseProperties(node);
+    parseProperties();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -73,17 +72,17 @@ void RomInfoWidget::clearProperties()
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void RomInfoWidget::reloadProperties(const FilesystemNode& node)
+void RomInfoWidget::reloadProperties()
 {
   // The ROM may have changed since we were last in the browser, either
   // by saving a different image or through a change in video renderer,
   // so we reload the properties
   if(myHaveProperties)
-    parseProperties(node);
+    parseProperties();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void RomInfoWidget::parseProperties(const FilesystemNode& node)
+void RomInfoWidget::parseProperties()
 {
   // Check if a surface has ever been created; if so, we use it
   // The surface will always be the maximum size, but sometimes we'll
@@ -134,37 +133,21 @@ void RomInfoWidget::parseProperties(const FilesystemNode& node)
   myRomInfo.push_back("Note: " + myProperties.get(PropType::Cart_Note));
   bool swappedPorts = myProperties.get(PropType::Console_SwapPorts) == "YES";
 
-  // Load the image for controller and bankswitch type auto detection
-  string left = myProperties.get(PropType::Controller_Left);
-  string right = myProperties.get(PropType::Controller_Right);
-  Controller::Type leftType = Controller::getType(left);
-  Controller::Type rightType = Controller::getType(right);
+  // Use the autodetected controller and bankswitch types from the ROM
+  // index, unless the properties define them
+  Controller::Type leftType =
+      Controller::getType(myProperties.get(PropType::Controller_Left));
+  Controller::Type rightType =
+      Controller::getType(myProperties.get(PropType::Controller_Right));
+  const string left = leftType != Controller::Type::Unknown
+      ? Controller::getName(leftType)
+      : !swappedPorts ? myRomEntry.leftPort : myRomEntry.rightPort;
+  const string right = rightType != Controller::Type::Unknown
+      ? Controller::getName(rightType)
+      : !swappedPorts ? myRomEntry.rightPort : myRomEntry.leftPort;
   string bsDetected = myProperties.get(PropType::Cart_Type);
-  try
-  {
-    ByteBuffer image;
-    string md5 = "";  size_t size = 0;
-
-    if(node.exists() && !node.isDirectory() &&
-      (image = instance().openROM(node, md5, size)) != nullptr)
-    {
-      Logger::debug(myProperties.get(PropType::Cart_Name) + ":");
-      left = ControllerDetector::detectName(image, size, leftType,
-          !swappedPorts ? Controller::Jack::Left : Controller::Jack::Right,
-          instance().settings());
-      right = ControllerDetector::detectName(image, size, rightType,
-          !swappedPorts ? Controller::Jack::Right : Controller::Jack::Left,
-          instance().settings());
-      if (bsDetected == "AUTO")
-        bsDetected = Bankswitch::typeToName(CartDetector::autodetectType(image, size));
-    }
-  }
-  catch(const runtime_error&)
-  {
-    // Do nothing; we simply don't update the controllers if openROM
-    // failed for any reason
-    left = right = "";
-  }
+  if(bsDetected == "AUTO")
+    bsDetected = myRomEntry.bsType;
   if(left != "" && right != "")
     myRomInfo.push_back("Controllers: " + (left + " (left), " + right + " (right)"));
   if (bsDetected != "")
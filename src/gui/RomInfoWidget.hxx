@@ -25,6 +25,7 @@ namespace Common {
 }
 
 #include "Widget.hxx"
+#include "RomIndexer.hxx"
 #include "bspf.hxx"
 
 class RomInfoWidget : public Widget
@@ -35,9 +36,9 @@ class RomInfoWidget : public Widget
                   const Common::Size& imgSize);
     ~RomInfoWidget() override = default;
 
-    void setProperties(const FilesystemNode& node, const string& md5);
+    void setProperties(const FilesystemNode& node, const RomIndexer::Entry& entry);
     void clearProperties();
-    void reloadProperties(const FilesystemNode& node);
+    void reloadProperties();
 
     void resetSurfaces();
 
@@ -45,7 +46,7 @@ class RomInfoWidget : public Widget
     void drawWidget(bool hilite) override;
 
   private:
-    void parseProperties(const FilesystemNode& node);
+    void parseProperties();
   #ifdef PNG_SUPPORT
     bool loadPng(const string& filename);
   #endif
@@ -63,6 +64,9 @@ class RomInfoWidget : public Widget
     // The properties for the currently selected ROM
     Properties myProperties;
 
+    // The index entry (MD5 and autodetected types) for the currently selected ROM
+    RomIndexer::Entry myRomEntry;
+
     // Indicates if the current properties should actually be used
     bool myHaveProperties{false};
 
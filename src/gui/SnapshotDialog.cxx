@@ -43,7 +43,7 @@ SnapshotDialog::SnapshotDialog(OSystem& osystem, DialogContainer& parent,
   ButtonWidget* b;
 
   // Set real dimensions
-  setSize(64 * fontWidth + HBORDER * 2, 9 * (lineHeight + VGAP) + VBORDER + _th, max_w, max_h);
+  setSize(64 * fontWidth + HBORDER * 2, 10 * (lineHeight + VGAP) + VBORDER + _th, max_w, max_h);
 
   xpos = HBORDER;  ypos = VBORDER + _th;
 
@@ -68,6 +68,19 @@ SnapshotDialog::SnapshotDialog(OSystem& osystem, DialogContainer& parent,
   mySnapInterval->setTickmarkIntervals(3);
   wid.push_back(mySnapInterval);
 
+  // Snapshot compression level
+  ypos += lineHeight + VGAP;
+  mySnapCompression = new SliderWidget(this, font, xpos, ypos,
+                                       "Compression level ",
+                                       font.getStringWidth("Continuous snapshot interval "), 0,
+                                       font.getStringWidth("10 seconds"));
+  mySnapCompression->setMinValue(0);
+  mySnapCompression->setMaxValue(9);
+  mySnapCompression->setTickmarkIntervals(3);
+  mySnapCompression->setToolTip("Lower levels are faster, especially in continuous\n"
+                                "snapshot mode, but create larger files.");
+  wid.push_back(mySnapCompression);
+
   // Booleans for saving snapshots
   fwidth = font.getStringWidth("When saving snapshots:");
   xpos = HBORDER;  ypos += lineHeight + VGAP * 3;
@@ -101,6 +114,7 @@ void SnapshotDialog::loadConfig()
   const Settings& settings = instance().settings();
   mySnapSavePath->setText(settings.getString("snapsavedir"));
   mySnapInterval->setValue(instance().settings().getInt("ssinterval"));
+  mySnapCompression->setValue(settings.getInt("sscompress"));
   mySnapName->setState(instance().settings().getString("snapname") == "rom");
   mySnapSingle->setState(settings.getBool("sssingle"));
   mySnap1x->setState(settings.getBool("ss1x"));
@@ -111,6 +125,7 @@ void SnapshotDialog::saveConfig()
 {
   instance().settings().setValue("snapsavedir", mySnapSavePath->getText());
   instance().settings().setValue("ssinterval", mySnapInterval->getValue());
+  instance().settings().setValue("sscompress", mySnapCompression->getValue());
   instance().settings().setValue("snapname", mySnapName->getState() ? "rom" : "int");
   instance().settings().setValue("sssingle", mySnapSingle->getState());
   instance().settings().setValue("ss1x", mySnap1x->getState());
@@ -125,6 +140,7 @@ void SnapshotDialog::setDefaults()
 {
   mySnapSavePath->setText(instance().userDir().getShortPath());
   mySnapInterval->setValue(2);
+  mySnapCompression->setValue(6);
   mySnapName->setState(false);
   mySnapSingle->setState(false);
   mySnap1x->setState(false);
@@ -54,6 +54,7 @@ class SnapshotDialog : public Dialog
 
     CheckboxWidget* mySnapName{nullptr};
     SliderWidget* mySnapInterval{nullptr};
+    SliderWidget* mySnapCompression{nullptr};
 
     CheckboxWidget* mySnapSingle{nullptr};
     CheckboxWidget* mySnap1x{nullptr};
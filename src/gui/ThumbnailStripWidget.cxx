@@ -0,0 +1,157 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "bspf.hxx"
+#include "Dialog.hxx"
+#include "FBSurface.hxx"
+#include "FrameBuffer.hxx"
+#include "OSystem.hxx"
+#include "StateManager.hxx"
+#include "RewindManager.hxx"
+#include "ThumbnailGenerator.hxx"
+#include "TIAConstants.hxx"
+#include "TIASurface.hxx"
+
+#include "ThumbnailStripWidget.hxx"
+
+static constexpr int THUMB_W = TIAConstants::H_PIXEL / ThumbnailGenerator::H_SCALE;
+static constexpr int CELL_GAP = 4;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ThumbnailStripWidget::ThumbnailStripWidget(GuiObject* boss, const GUI::Font& font,
+                                           int x, int y, int w, int h, int cmd)
+  : Widget(boss, font, x, y, w, h),
+    CommandSender(boss),
+    myCmd{cmd},
+    myCellWidth{THUMB_W + 2 + CELL_GAP}
+{
+  _flags = Widget::FLAG_ENABLED | Widget::FLAG_CLEARBG | Widget::FLAG_NOBG;
+  _bgcolor = kDlgColor;
+  _bgcolorhi = kDlgColor;
+
+  myLineBuffer.resize(THUMB_W);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RewindManager& ThumbnailStripWidget::rewindManager() const
+{
+  return instance().state().rewindManager();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailStripWidget::setStates(uInt32 numStates, uInt32 selected)
+{
+  myNumStates = numStates;
+  mySelected = selected;
+
+  // Keep the selected state visible, center it when jumping
+  if(mySelected < myFirst || mySelected >= myFirst + numVisible())
+    scrollTo(Int32(mySelected) - Int32(numVisible() / 2));
+  else
+    scrollTo(myFirst);
+
+  setDirty();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailStripWidget::scrollTo(Int32 first)
+{
+  const Int32 maxFirst = std::max(0, Int32(myNumStates) - Int32(numVisible()));
+
+  myFirst = BSPF::clamp(first, 0, maxFirst);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailStripWidget::tick()
+{
+  if(isEnabled() && myNumStates)
+  {
+    RewindManager& r = rewindManager();
+
+    // Only the visible thumbnails are requested; they are created in the
+    // background and shown as soon as they become available
+    r.requestThumbnails(myFirst, std::min(myFirst + numVisible(), myNumStates) - 1);
+    if(r.updateThumbnails())
+      setDirty();
+  }
+  Widget::tick();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailStripWidget::handleMouseUp(int x, int y, MouseButton b, int clickCount)
+{
+  if(isEnabled() && b == MouseButton::LEFT && x >= 0 && x < _w)
+  {
+    const uInt32 idx = myFirst + x / myCellWidth;
+
+    if(idx < myNumStates && idx != mySelected)
+      sendCommand(myCmd, idx, _id);
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailStripWidget::handleMouseWheel(int x, int y, int direction)
+{
+  if(isEnabled())
+  {
+    // Scrolling only changes the visible range, the state is not changed
+    scrollTo(Int32(myFirst) + (direction > 0 ? -1 : 1));
+    setDirty();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ThumbnailStripWidget::drawWidget(bool hilite)
+{
+  FBSurface& s = _boss->dialog().surface();
+  const TIASurface& tiaSurface = instance().frameBuffer().tiaSurface();
+  const RewindManager& r = rewindManager();
+  const uInt32 last = std::min(myFirst + numVisible(), myNumStates);
+  const int cellH = _h - 2;
+  int x = _x;
+
+  for(uInt32 idx = myFirst; idx < last; ++idx, x += myCellWidth)
+  {
+    s.frameRect(x, _y, THUMB_W + 2, _h,
+                idx == mySelected ? kColorInfo : kBGColor);
+
+    shared_ptr<const RewindManager::Thumbnail> thumb = r.thumbnail(idx);
+    if(thumb)
+    {
+      // Thumbnails are centered vertically and clipped if necessary
+      const int h = std::min(int(thumb->height), cellH);
+      const int yOfs = (int(thumb->height) - h) / 2;
+      const int yDst = _y + 1 + (cellH - h) / 2;
+
+      for(int y = 0; y < h; ++y)
+      {
+        const uInt8* src = thumb->pixels.data() + size_t(y + yOfs) * thumb->width;
+
+        for(uInt32 i = 0; i < thumb->width; ++i)
+          myLineBuffer[i] = tiaSurface.mapIndexedPixel(src[i]);
+        s.drawPixels(myLineBuffer.data(), x + 1, yDst + y, thumb->width);
+      }
+      if(cellH > h)
+      {
+        s.fillRect(x + 1, _y + 1, THUMB_W, yDst - _y - 1, kBGColor);
+        s.fillRect(x + 1, yDst + h, THUMB_W, _y + 1 + cellH - yDst - h, kBGColor);
+      }
+    }
+    else
+      s.fillRect(x + 1, _y + 1, THUMB_W, cellH, kBGColor);
+  }
+}
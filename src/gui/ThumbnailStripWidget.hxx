@@ -0,0 +1,79 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2021 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef THUMBNAIL_STRIP_WIDGET_HXX
+#define THUMBNAIL_STRIP_WIDGET_HXX
+
+class RewindManager;
+
+#include "Widget.hxx"
+#include "Command.hxx"
+
+/**
+  A horizontal, scrollable strip of Time Machine state thumbnails.  The
+  thumbnails are created in the background by the RewindManager; scrolling
+  the strip never loads any state.  Clicking on a thumbnail sends the
+  (0-based) index of the state with the widget's command.
+*/
+class ThumbnailStripWidget : public Widget, public CommandSender
+{
+  public:
+    ThumbnailStripWidget(GuiObject* boss, const GUI::Font& font,
+                         int x, int y, int w, int h, int cmd = 0);
+    ~ThumbnailStripWidget() override = default;
+
+    /**
+      Set the number of states and the selected (0-based) state.  If the
+      selected state is outside the visible range, the strip is scrolled.
+    */
+    void setStates(uInt32 numStates, uInt32 selected);
+
+    void tick() override;
+
+  protected:
+    void handleMouseUp(int x, int y, MouseButton b, int clickCount) override;
+    void handleMouseWheel(int x, int y, int direction) override;
+
+    void drawWidget(bool hilite) override;
+
+  private:
+    RewindManager& rewindManager() const;
+
+    uInt32 numVisible() const { return std::max(1, (_w - 1) / myCellWidth); }
+    void scrollTo(Int32 first);
+
+  private:
+    int myCmd{0};
+    int myCellWidth{0};
+
+    uInt32 myNumStates{0};
+    uInt32 mySelected{0};
+    uInt32 myFirst{0};
+
+    // Buffer for converting one thumbnail row
+    uIntArray myLineBuffer;
+
+  private:
+    // Following constructors and assignment operators not supported
+    ThumbnailStripWidget() = delete;
+    ThumbnailStripWidget(const ThumbnailStripWidget&) = delete;
+    ThumbnailStripWidget(ThumbnailStripWidget&&) = delete;
+    ThumbnailStripWidget& operator=(const ThumbnailStripWidget&) = delete;
+    ThumbnailStripWidget& operator=(ThumbnailStripWidget&&) = delete;
+};
+
+#endif
@@ -25,6 +25,8 @@
 #include "StateManager.hxx"
 #include "RewindManager.hxx"
 #include "TimeLineWidget.hxx"
+#include "ThumbnailStripWidget.hxx"
+#include "ThumbnailGenerator.hxx"
 #include "TIASurface.hxx"
 
 #include "Console.hxx"
@@ -208,13 +210,15 @@ TimeMachineDialog::TimeMachineDialog(OSystem& osystem, DialogContainer& parent,
   const int H_BORDER = 6, BUTTON_GAP = 4, V_BORDER = 4;
   const int buttonWidth = BUTTON_W + 10,
             buttonHeight = BUTTON_H + 10,
-            rowHeight = font.getLineHeight();
+            rowHeight = font.getLineHeight(),
+            // thumbnails of typical frame heights fit completely
+            thumbHeight = 240 / ThumbnailGenerator::V_SCALE + 2;
 
   int xpos, ypos;
 
   // Set real dimensions
   _w = width;  // Parent determines our width (based on window size)
-  _h = V_BORDER * 2 + rowHeight + std::max(buttonHeight + 2, rowHeight);
+  _h = V_BORDER * 3 + thumbHeight + rowHeight + std::max(buttonHeight + 2, rowHeight);
 
   this->clearFlags(Widget::FLAG_CLEARBG); // does only work combined with blending (0..100)!
   this->clearFlags(Widget::FLAG_BORDER);
@@ -223,6 +227,11 @@ TimeMachineDialog::TimeMachineDialog(OSystem& osystem, DialogContainer& parent,
   xpos = H_BORDER;
   ypos = V_BORDER;
 
+  // Add thumbnail strip
+  myThumbnails = new ThumbnailStripWidget(this, font, xpos, ypos,
+                                          _w - H_BORDER * 2, thumbHeight, kThumbnail);
+  ypos += thumbHeight + V_BORDER;
+
   // Add index info
   myCurrentIdxWidget = new StaticTextWidget(this, font, xpos, ypos, "1000", TextAlign::Left, kBGColor);
   myCurrentIdxWidget->setTextColor(kColorInfo);
@@ -417,6 +426,13 @@ void TimeMachineDialog::handleCommand(CommandSender* sender, int cmd,
       break;
     }
 
+    case kThumbnail:
+    {
+      Int32 winds = data - instance().state().rewindManager().getCurrentIdx() + 1;
+      handleWinds(winds);
+      break;
+    }
+
     case kToggle:
       instance().state().toggleTimeMachine();
       handleToggle();
@@ -547,6 +563,7 @@ void TimeMachineDialog::handleWinds(Int32 numWinds)
   myCurrentTimeWidget->setLabel(getTimeString(r.getCurrentCycles() - r.getFirstCycles()));
   myLastTimeWidget->setLabel(getTimeString(r.getLastCycles() - r.getFirstCycles()));
   myTimeline->setValue(r.getCurrentIdx()-1);
+  myThumbnails->setStates(r.getLastIdx(), r.getCurrentIdx()-1);
   // Update index
   myCurrentIdxWidget->setValue(r.getCurrentIdx());
   myLastIdxWidget->setValue(r.getLastIdx());
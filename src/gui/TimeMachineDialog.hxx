@@ -22,6 +22,7 @@ class CommandSender;
 class DialogContainer;
 class OSystem;
 class TimeLineWidget;
+class ThumbnailStripWidget;
 
 #include "Dialog.hxx"
 
@@ -58,6 +59,7 @@ class TimeMachineDialog : public Dialog
     enum
     {
       kTimeline  = 'TMtl',
+      kThumbnail = 'TMth',
       kToggle    = 'TMtg',
       kExit      = 'TMex',
       kPlayBack  = 'TMpb',
@@ -72,6 +74,7 @@ class TimeMachineDialog : public Dialog
     };
 
     TimeLineWidget* myTimeline{nullptr};
+    ThumbnailStripWidget* myThumbnails{nullptr};
 
     ButtonWidget* myToggleWidget{nullptr};
     ButtonWidget* myExitWidget{ nullptr };
@@ -42,12 +42,14 @@ MODULE_OBJS := \
 	src/gui/R77HelpDialog.o \
 	src/gui/RadioButtonWidget.o \
 	src/gui/RomAuditDialog.o \
+	src/gui/RomIndexer.o \
 	src/gui/RomInfoWidget.o \
 	src/gui/ScrollBarWidget.o \
 	src/gui/SnapshotDialog.o \
 	src/gui/StellaSettingsDialog.o \
 	src/gui/StringListWidget.o \
 	src/gui/TabWidget.o \
+	src/gui/ThumbnailStripWidget.o \
 	src/gui/TimeLineWidget.o \
 	src/gui/TimeMachineDialog.o \
 	src/gui/TimeMachine.o \
@@ -61,3 +61,15 @@ shared_ptr<CompositeKeyValueRepositoryAtomic> OSystemLIBRETRO::getHighscoreRepos
 {
   return make_shared<CompositeKeyValueRepositoryNoop>();
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<CompositeKeyValueRepositoryAtomic> OSystemLIBRETRO::getAutodetectRepository()
+{
+  return make_shared<CompositeKeyValueRepositoryNoop>();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<KeyValueRepositoryAtomic> OSystemLIBRETRO::getRomIndexRepository()
+{
+  return make_shared<KeyValueRepositoryNoop>();
+}
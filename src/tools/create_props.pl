@@ -66,23 +66,116 @@ print OUTFILE "  located in the src/tools directory.  All properties changes\n";
 print OUTFILE "  should be made in stella.pro, and then this file should be\n";
 print OUTFILE "  regenerated and the application recompiled.\n";
 print OUTFILE "*/\n";
-print OUTFILE "\nstatic constexpr uInt32 DEF_PROPS_SIZE = " . $setsize . ";";
-print OUTFILE "\n\n";
-print OUTFILE "static const BSPF::array2D<const char*, DEF_PROPS_SIZE, " . $typesize . "> DefProps = {{\n";
+# The MD5 sums are stored as four 32-bit words, and looked up using a
+# perfect hash: the third word selects a bucket, and each bucket has a
+# displacement chosen so that all its keys land in distinct free slots
+my $numslots   = 4096;
+my $numbuckets = 1024;
+if ($setsize > $numslots) {
+  die "Too many properties for $numslots hash slots\n";
+}
 
-# Walk the hash map and print each item in order of md5sum
-my $idx = 0;
+my @md5words = ();
+my @rows = ();
+my @strings = ( "" );
+my %stringidx = ( "" => 0 );
 for my $key ( sort keys %propset )
 {
-  print OUTFILE PropSet::build_prop_string(@{ $propset{$key} });
+  push(@md5words, [ map { hex(substr($key, $_ * 8, 8)) } 0..3 ]);
 
-  if ($idx+1 < $setsize) {
-    print OUTFILE ",";
+  # Property values are interned; the MD5 sum itself isn't stored again
+  my @values = PropSet::build_prop_values(@{ $propset{$key} });
+  $values[0] = "";
+  my @indices = ();
+  for my $value (@values)
+  {
+    if (!defined($stringidx{$value})) {
+      $stringidx{$value} = @strings;
+      push(@strings, $value);
+    }
+    push(@indices, $stringidx{$value});
   }
-  print OUTFILE "\n";
-  $idx++;
+  push(@rows, [ @indices ]);
+}
+if (@strings > 65536) {
+  die "Too many distinct property values\n";
 }
 
+# Fill the largest buckets first, while most slots are still free
+my @buckets = map { [] } 1..$numbuckets;
+for (my $i = 0; $i < $setsize; $i++) {
+  push(@{ $buckets[$md5words[$i][2] % $numbuckets] }, $i);
+}
+my @displace = (0) x $numbuckets;
+my @slots = (-1) x $numslots;
+for my $b ( sort { @{ $buckets[$b] } <=> @{ $buckets[$a] } || $a <=> $b } 0..$numbuckets-1 )
+{
+  my $found = 0;
+  for (my $d = 0; $d < $numslots && !$found; $d++)
+  {
+    my %used = ();
+    $found = 1;
+    for my $i (@{ $buckets[$b] })
+    {
+      my $slot = ($md5words[$i][0] + $d * ($md5words[$i][1] | 1)) % $numslots;
+      if ($slots[$slot] >= 0 || defined($used{$slot})) {
+        $found = 0;
+        last;
+      }
+      $used{$slot} = $i;
+    }
+    if ($found) {
+      $displace[$b] = $d;
+      while (my ($slot, $i) = each(%used)) {
+        $slots[$slot] = $i;
+      }
+    }
+  }
+  die "Couldn't create perfect hash for bucket $b\n" if !$found;
+}
+# Unused slots refer to an entry whose MD5 sum won't match
+@slots = map { $_ < 0 ? 0 : $_ } @slots;
+
+print OUTFILE "\nstatic constexpr uInt32 DEF_PROPS_SIZE = " . $setsize . ";\n";
+print OUTFILE "static constexpr uInt32 DEF_PROPS_SLOTS = " . $numslots . ";\n";
+print OUTFILE "static constexpr uInt32 DEF_PROPS_BUCKETS = " . $numbuckets . ";\n";
+print OUTFILE "static constexpr uInt32 DEF_PROPS_STRINGS = " . @strings . ";\n";
+print OUTFILE "\n";
+
+print OUTFILE "// The MD5 sums of all entries, as 32-bit words, sorted\n";
+print OUTFILE "static const BSPF::array2D<uInt32, DEF_PROPS_SIZE, 4> DefPropsMD5 = {{\n";
+for (my $i = 0; $i < $setsize; $i++) {
+  printf OUTFILE "  { 0x%08x, 0x%08x, 0x%08x, 0x%08x }", @{ $md5words[$i] };
+  print OUTFILE ($i+1 < $setsize ? ",\n" : "\n");
+}
+print OUTFILE "}};\n\n";
+
+print OUTFILE "// Hash displacement for each bucket (MD5 word 2 % DEF_PROPS_BUCKETS)\n";
+print OUTFILE "static const std::array<uInt16, DEF_PROPS_BUCKETS> DefPropsDisplace = {\n";
+print_numbers(@displace);
+print OUTFILE "};\n\n";
+
+print OUTFILE "// Entry for each hash slot; the slot of an MD5 sum with displacement d is\n";
+print OUTFILE "// (word 0 + d * (word 1 | 1)) % DEF_PROPS_SLOTS\n";
+print OUTFILE "static const std::array<uInt16, DEF_PROPS_SLOTS> DefPropsSlots = {\n";
+print_numbers(@slots);
+print OUTFILE "};\n\n";
+
+print OUTFILE "// All distinct property values\n";
+print OUTFILE "static const std::array<const char*, DEF_PROPS_STRINGS> DefPropsStrings = {\n";
+for (my $i = 0; $i < @strings; $i++) {
+  print OUTFILE "  \"$strings[$i]\"";
+  print OUTFILE ($i+1 < @strings ? ",\n" : "\n");
+}
+print OUTFILE "};\n\n";
+
+print OUTFILE "// The properties of all entries, as indices into DefPropsStrings\n";
+print OUTFILE "// (0 is the default value), in the same order as DefPropsMD5\n";
+print OUTFILE "static const BSPF::array2D<uInt16, DEF_PROPS_SIZE, " . $typesize . "> DefProps = {{\n";
+for (my $i = 0; $i < $setsize; $i++) {
+  print OUTFILE "  { " . join(", ", @{ $rows[$i] }) . " }";
+  print OUTFILE ($i+1 < $setsize ? ",\n" : "\n");
+}
 print OUTFILE "}};\n";
 print OUTFILE "\n";
 print OUTFILE "#endif\n";
@@ -90,6 +183,15 @@ print OUTFILE "#endif\n";
 close(OUTFILE);
 
 
+sub print_numbers {
+  my @numbers = @_;
+  for (my $i = 0; $i < @numbers; $i += 16) {
+    my $last = $i + 15 < $#numbers ? $i + 15 : $#numbers;
+    print OUTFILE "  " . join(", ", @numbers[$i..$last]);
+    print OUTFILE ($last < $#numbers ? ",\n" : "\n");
+  }
+}
+
 sub usage {
   print "create_props.pl <INPUT properties file> <OUTPUT C++ header>\n";
   print "\n";
@@ -178,6 +178,20 @@ bool FilesystemNodePOSIX::getChildren(AbstractFSList& myList, ListMode mode) con
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+size_t FilesystemNodePOSIX::getSize() const
+{
+  struct stat st;
+  return (_isFile && stat(_path.c_str(), &st) == 0) ? size_t(st.st_size) : 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 FilesystemNodePOSIX::getLastModified() const
+{
+  struct stat st;
+  return stat(_path.c_str(), &st) == 0 ? uInt64(st.st_mtime) : 0;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool FilesystemNodePOSIX::makeDir()
 {
@@ -70,6 +70,8 @@ class FilesystemNodePOSIX : public AbstractFSNode
     bool isFile() const override      { return _isFile;      }
     bool isReadable() const override  { return access(_path.c_str(), R_OK) == 0; }
     bool isWritable() const override  { return access(_path.c_str(), W_OK) == 0; }
+    size_t getSize() const override;
+    uInt64 getLastModified() const override;
     bool makeDir() override;
     bool rename(const string& newfile) override;
 
@@ -57,6 +57,31 @@ bool FilesystemNodeWINDOWS::isWritable() const
   return _access(_path.c_str(), W_OK) == 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+size_t FilesystemNodeWINDOWS::getSize() const
+{
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if(!_isFile ||
+     !GetFileAttributesEx(toUnicode(_path.c_str()), GetFileExInfoStandard, &data))
+    return 0;
+
+  return size_t((uInt64(data.nFileSizeHigh) << 32) | data.nFileSizeLow);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 FilesystemNodeWINDOWS::getLastModified() const
+{
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if(!GetFileAttributesEx(toUnicode(_path.c_str()), GetFileExInfoStandard, &data))
+    return 0;
+
+  // FILETIME counts 100ns intervals since 1601-01-01; convert to Unix time
+  const uInt64 time = (uInt64(data.ftLastWriteTime.dwHighDateTime) << 32) |
+                      data.ftLastWriteTime.dwLowDateTime;
+  return time >= 116444736000000000ULL ?
+    (time - 116444736000000000ULL) / 10000000ULL : 0;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void FilesystemNodeWINDOWS::setFlags()
 {